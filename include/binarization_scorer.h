@@ -0,0 +1,81 @@
+#ifndef BINARIZATION_SCORER_H
+#define BINARIZATION_SCORER_H
+
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace jetson_lpr {
+
+/**
+ * Puntaje de una binarización
+ */
+struct BinarizationScore {
+    int components;             // Componentes con tamaño y proporción de carácter
+    int aligned;                // Componentes de la fila más larga
+    float stroke_consistency;   // Uniformidad del grosor de trazo (0-1)
+    float score;                // Puntaje combinado (0-1)
+
+    BinarizationScore()
+        : components(0)
+        , aligned(0)
+        , stroke_consistency(0.0f)
+        , score(0.0f)
+    {}
+};
+
+/**
+ * Puntuación barata de binarizaciones antes del OCR
+ *
+ * Una binarización buena separa los caracteres en componentes conexos
+ * sueltos, de alto y proporción de carácter, alineados en una fila de
+ * unos 6 (ABC123) y con grosor de trazo parecido. Contar eso cuesta un
+ * etiquetado de componentes, mucho menos que una llamada a Tesseract,
+ * así que permite leer solo las mejores candidatas.
+ *
+ * Thread-safe: no guarda estado entre llamadas.
+ */
+class BinarizationScorer {
+public:
+    /**
+     * Constructor
+     *
+     * @param expected_characters Caracteres esperados en la fila (default: 6)
+     */
+    explicit BinarizationScorer(int expected_characters = 6);
+
+    /**
+     * Puntuar una binarización
+     *
+     * Se evalúan las dos polaridades (caracteres negros o blancos) y se
+     * devuelve la mejor.
+     *
+     * @param binary Imagen binarizada (CV_8UC1, 0/255)
+     * @return Puntaje
+     */
+    BinarizationScore score(const cv::Mat& binary) const;
+
+    /**
+     * Puntuar y devolver los caracteres de la fila encontrada
+     *
+     * @param binary Imagen binarizada (CV_8UC1, 0/255)
+     * @param characters Cajas de los caracteres alineados, de izquierda a derecha
+     * @param dark_text true si los caracteres son los píxeles en 0
+     * @return Puntaje de la mejor polaridad
+     */
+    BinarizationScore segment(const cv::Mat& binary, std::vector<cv::Rect>& characters, bool& dark_text) const;
+
+private:
+    int expected_characters_;
+
+    /**
+     * Puntuar tomando como caracteres los píxeles distintos de cero
+     *
+     * @param characters Si no es nulo, recibe las cajas de la fila (de izquierda a derecha)
+     */
+    BinarizationScore scoreForeground(const cv::Mat& foreground,
+                                      std::vector<cv::Rect>* characters = nullptr) const;
+};
+
+} // namespace jetson_lpr
+
+#endif // BINARIZATION_SCORER_H
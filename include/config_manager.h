@@ -2,6 +2,7 @@
 #define CONFIG_MANAGER_H
 
 #include <string>
+#include <vector>
 #include <memory>
 
 namespace jetson_lpr {
@@ -46,6 +47,17 @@ public:
      */
     bool getBool(const std::string& key, bool default_value = false) const;
     
+    /**
+     * Obtener arreglo numérico de configuración (ej. [0.1, 0.2, 0.5, 0.3])
+     */
+    std::vector<double> getDoubleArray(const std::string& key) const;
+    
+    /**
+     * Obtener número de elementos de un arreglo (0 si no es arreglo)
+     * Los elementos se acceden con el índice en la clave: "tiling.zones.0"
+     */
+    size_t getArraySize(const std::string& key) const;
+    
     /**
      * Verificar si existe una clave
      */
@@ -103,7 +115,7 @@ private:
     std::unique_ptr<JsonHolder> json_data_;
     
     /**
-     * Obtener valor JSON anidado usando clave con "."
+     * Obtener valor JSON anidado usando clave con "." (índices para arreglos)
      */
     void* getNestedValue(const std::string& key) const;
     
@@ -0,0 +1,119 @@
+#ifndef CTC_PLATE_RECOGNIZER_H
+#define CTC_PLATE_RECOGNIZER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <opencv2/opencv.hpp>
+
+#include "plate_recognizer.h"
+#include "inference_backend.h"
+
+namespace jetson_lpr {
+
+/**
+ * Parámetros del reconocedor CTC
+ */
+struct CTCRecognizerConfig {
+    std::string model_path;     // Modelo ONNX (CRNN / LPRNet)
+    int input_width;            // Ancho de entrada fijo (default: 94, LPRNet)
+    int input_height;           // Alto de entrada fijo (default: 24)
+    int channels;               // 3 = BGR, 1 = gris (default: 3)
+    bool swap_rb;               // Entregar RGB en lugar de BGR (default: false)
+    double mean;                // Se resta a cada canal (default: 127.5)
+    double scale;               // Se multiplica tras restar la media (default: 1/128)
+    std::string alphabet;       // Caracteres en el orden de las clases (sin blank)
+    int blank_index;            // Clase blank (0 = primera, -1 = última)
+    std::string output_layout;  // "auto", "NTC", "TNC" o "NCT"
+    int max_batch;              // Placas por inferencia (default: 8)
+    int beam_width;             // 1 = greedy, >1 = beam search por prefijos
+    InferenceOptions inference; // Backend del modelo
+
+    CTCRecognizerConfig()
+        : input_width(94)
+        , input_height(24)
+        , channels(3)
+        , swap_rb(false)
+        , mean(127.5)
+        , scale(0.0078125)
+        , alphabet("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ")
+        , blank_index(0)
+        , output_layout("auto")
+        , max_batch(8)
+        , beam_width(1)
+    {}
+};
+
+/**
+ * Reconocedor de placas con un modelo CTC (CRNN / LPRNet) en ONNX
+ *
+ * Lee el recorte en color directamente, sin binarizaciones: todas las
+ * placas de un frame se redimensionan al tamaño fijo de entrada y van en
+ * un solo lote al backend de inferencia. La salida (T pasos × C clases)
+ * se pasa a probabilidades con softmax por fila y se decodifica con CTC
+ * greedy (argmax por paso, unir repetidos, quitar blanks) o con beam
+ * search por prefijos. Cada carácter lleva su probabilidad.
+ *
+ * Thread-safe: la inferencia se serializa (el backend no es thread-safe),
+ * el preprocesado y la decodificación no.
+ */
+class CTCPlateRecognizer : public PlateRecognizer {
+public:
+    explicit CTCPlateRecognizer(const CTCRecognizerConfig& config);
+
+    bool initialize() override;
+
+    std::vector<OCRResult> recognizeBatch(const std::vector<cv::Mat>& plates) override;
+
+    std::string name() const override;
+
+    /**
+     * Decodificar una secuencia de probabilidades
+     *
+     * @param probabilities Matriz T × C (CV_32F), una fila por paso, ya normalizada
+     * @return Texto con la probabilidad de cada carácter
+     */
+    OCRResult decode(const cv::Mat& probabilities) const;
+
+private:
+    CTCRecognizerConfig config_;
+    int num_classes_;
+    int blank_;
+
+    std::unique_ptr<InferenceBackend> backend_;
+    std::mutex backend_mutex_;
+    bool initialized_;
+    std::atomic<bool> batch_supported_;     // false: modelo exportado con batch fijo de 1
+
+    /**
+     * Inferir un lote (como mucho max_batch placas)
+     */
+    bool inferChunk(const std::vector<cv::Mat>& plates, size_t begin, size_t end,
+                    std::vector<OCRResult>& results);
+
+    /**
+     * Extraer la matriz T × C de una placa del tensor de salida
+     */
+    bool sequenceFor(const cv::Mat& output, int batch, int plate, cv::Mat& sequence) const;
+
+    /**
+     * Softmax por fila (no-op si las filas ya son probabilidades)
+     */
+    static void toProbabilities(cv::Mat& sequence);
+
+    OCRResult decodeGreedy(const cv::Mat& probabilities) const;
+    OCRResult decodeBeam(const cv::Mat& probabilities) const;
+
+    /**
+     * Carácter de una clase (no blank)
+     */
+    char classToChar(int index) const {
+        return config_.alphabet[index < blank_ ? index : index - 1];
+    }
+};
+
+} // namespace jetson_lpr
+
+#endif // CTC_PLATE_RECOGNIZER_H
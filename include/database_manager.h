@@ -18,6 +18,7 @@ struct DetectionData {
     int vehicle_bbox[4];              // Bbox del vehículo [x, y, w, h]
     int plate_bbox[4];                // Bbox de la placa [x, y, w, h]
     std::string camera_location;      // Ubicación de la cámara
+    std::string plate_type;           // Tipo de placa por color (vacío = sin clasificar)
     std::string timestamp;            // Timestamp (ISO 8601)
     
     DetectionData() 
@@ -117,6 +118,16 @@ private:
      */
     bool executeQuery(const std::string& query);
     
+    /**
+     * Agregar una columna a una tabla existente si aún no la tiene
+     * 
+     * @param table Tabla
+     * @param column Columna
+     * @param definition Tipo y default de la columna
+     * @return true si la columna existe al terminar
+     */
+    bool ensureColumn(const std::string& table, const std::string& column, const std::string& definition);
+    
     /**
      * Obtener timestamp actual en formato MySQL
      * 
@@ -0,0 +1,107 @@
+#ifndef DETECTION_BATCHER_H
+#define DETECTION_BATCHER_H
+
+#include "detector.h"
+
+#include <vector>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <opencv2/opencv.hpp>
+
+namespace jetson_lpr {
+
+/**
+ * Agrupador de solicitudes de detección
+ *
+ * Acumula los frames que llegan desde varias cámaras (o recortes ROI)
+ * durante una ventana corta y los envía juntos a PlateDetector::detectBatch.
+ * El lote se despacha al llenarse o al vencer la ventana del primer frame,
+ * así la latencia añadida nunca supera window_ms.
+ */
+class DetectionBatcher {
+public:
+    /**
+     * Constructor
+     *
+     * @param detector Detector compartido (solo lo usa el hilo del batcher)
+     * @param max_batch_size Tamaño máximo del lote (default: 4)
+     * @param window_ms Espera máxima desde el primer frame pendiente (default: 5 ms)
+     */
+    DetectionBatcher(PlateDetector& detector,
+                     int max_batch_size = 4,
+                     double window_ms = 5.0);
+
+    /**
+     * Destructor
+     */
+    ~DetectionBatcher();
+
+    /**
+     * Iniciar hilo de despacho
+     */
+    void start();
+
+    /**
+     * Detener hilo de despacho (las solicitudes pendientes se procesan antes)
+     */
+    void stop();
+
+    /**
+     * Encolar un frame para detección
+     *
+     * @param frame Frame de entrada
+     * @return Futuro con las detecciones del frame
+     */
+    std::future<std::vector<PlateDetection>> submit(const cv::Mat& frame);
+
+    /**
+     * Detectar de forma síncrona a través del batcher
+     *
+     * @param frame Frame de entrada
+     * @return Detecciones del frame
+     */
+    std::vector<PlateDetection> detect(const cv::Mat& frame) {
+        return submit(frame).get();
+    }
+
+    /**
+     * Obtener tamaño promedio de los lotes despachados
+     */
+    double getAverageBatchSize() const;
+
+private:
+    struct Request {
+        cv::Mat frame;
+        std::promise<std::vector<PlateDetection>> promise;
+        std::chrono::steady_clock::time_point arrival;
+    };
+
+    PlateDetector& detector_;
+    size_t max_batch_size_;
+    std::chrono::microseconds window_;
+
+    std::deque<Request> pending_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+
+    std::thread worker_;
+    std::atomic<bool> running_;
+
+    // Estadísticas
+    std::atomic<uint64_t> batches_dispatched_;
+    std::atomic<uint64_t> frames_dispatched_;
+
+    /**
+     * Hilo de despacho de lotes
+     */
+    void dispatchWorker();
+};
+
+} // namespace jetson_lpr
+
+#endif // DETECTION_BATCHER_H
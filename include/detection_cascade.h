@@ -0,0 +1,102 @@
+#ifndef DETECTION_CASCADE_H
+#define DETECTION_CASCADE_H
+
+#include "detector.h"
+#include "detection_batcher.h"
+#include "nms.h"
+
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace jetson_lpr {
+
+/**
+ * Configuración de la cascada vehículo → placa
+ */
+struct CascadeConfig {
+    cv::Rect2f roi;             // Región donde buscar vehículos (normalizada)
+    float crop_margin;          // Margen alrededor del vehículo (fracción de su tamaño)
+    int min_vehicle_size;       // Lado mínimo del vehículo en píxeles nativos
+    int max_vehicles;           // Vehículos por frame (los de mayor área)
+    int batch_size;             // Recortes por inferencia del detector de placas
+    float merge_iou;            // IoU para fusionar placas vistas en recortes solapados
+
+    CascadeConfig()
+        : roi(0.0f, 0.0f, 1.0f, 1.0f)
+        , crop_margin(0.1f)
+        , min_vehicle_size(48)
+        , max_vehicles(8)
+        , batch_size(4)
+        , merge_iou(0.5f)
+    {}
+};
+
+/**
+ * Placa detectada dentro de un vehículo
+ */
+struct CascadeDetection {
+    PlateDetection plate;       // Caja de la placa en coordenadas del frame
+    cv::Rect vehicle_bbox;      // Caja del vehículo en coordenadas del frame
+};
+
+/**
+ * Detección en cascada: vehículos a baja resolución, placas en sus recortes
+ *
+ * El detector de vehículos (otro PlateDetector con un modelo de vehículos y
+ * filtro de clases) corre con una entrada pequeña sobre la ROI. Luego el
+ * detector de placas corre solo dentro de los recortes de vehículos a
+ * resolución nativa, en lotes, así no hace falta buscar placas en todo el
+ * frame a resolución completa y cada placa queda asociada a su vehículo.
+ */
+class DetectionCascade {
+public:
+    /**
+     * Constructor
+     *
+     * @param vehicle_detector Detector de vehículos
+     * @param plate_detector Detector de placas
+     * @param config Configuración de la cascada
+     * @param plate_batcher Agrupador opcional para los recortes
+     */
+    DetectionCascade(PlateDetector& vehicle_detector,
+                     PlateDetector& plate_detector,
+                     const CascadeConfig& config,
+                     DetectionBatcher* plate_batcher = nullptr);
+
+    /**
+     * Detectar vehículos y sus placas
+     *
+     * @param frame Frame a resolución original
+     * @return Placas con su vehículo, en coordenadas del frame
+     */
+    std::vector<CascadeDetection> detect(const cv::Mat& frame);
+
+    /**
+     * Obtener vehículos del último frame (coordenadas del frame)
+     */
+    const std::vector<cv::Rect>& getLastVehicles() const {
+        return last_vehicles_;
+    }
+
+private:
+    PlateDetector& vehicle_detector_;
+    PlateDetector& plate_detector_;
+    CascadeConfig config_;
+    DetectionBatcher* plate_batcher_;
+
+    std::vector<cv::Rect> last_vehicles_;
+
+    // Buffers de la fusión entre recortes
+    CandidateBuffer candidates_;
+    std::vector<int> candidate_vehicle_;
+    FastNMS nms_;
+
+    /**
+     * Detectar placas en los recortes (lotes o batcher)
+     */
+    std::vector<std::vector<PlateDetection>> detectPlates(const std::vector<cv::Mat>& crops);
+};
+
+} // namespace jetson_lpr
+
+#endif // DETECTION_CASCADE_H
@@ -4,7 +4,13 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <functional>
 #include <opencv2/opencv.hpp>
+#include "nms.h"
+#include "inference_backend.h"
 
 namespace jetson_lpr {
 
@@ -22,9 +28,48 @@ struct PlateDetection {
         : bbox(box), confidence(conf), class_id(id) {}
 };
 
+/**
+ * Llevar detecciones de un frame reducido a otro tamaño (frame original)
+ * 
+ * Usa la escala exacta de cada eje (cv::resize redondea el tamaño, así que
+ * ancho y alto no escalan igual) y redondea los bordes hacia afuera para no
+ * cortar caracteres al recortar la placa a resolución completa.
+ * 
+ * @param detections Detecciones en coordenadas de `from`
+ * @param from Tamaño del frame donde se detectó
+ * @param to Tamaño del frame destino
+ * @return Detecciones en coordenadas de `to`, limitadas al frame
+ */
+std::vector<PlateDetection> mapDetectionsToFrame(const std::vector<PlateDetection>& detections,
+                                                 const cv::Size& from,
+                                                 const cv::Size& to);
+
+/**
+ * Tamaño de entrada del detector con su backend y buffers propios
+ * 
+ * Cada tamaño mantiene su instancia de backend (mismo modelo de forma
+ * dinámica o un modelo exportado para ese tamaño) y sus blobs, así cambiar
+ * de tamaño entre frames no reasigna memoria ni reconfigura la red.
+ */
+struct DetectorInput {
+    cv::Size size;                              // Tamaño de entrada de la red
+    std::string model_path;                     // Vacío = modelo principal
+    std::unique_ptr<InferenceBackend> backend;
+    cv::Mat blob;                               // Buffer de detect()/detectAsync()
+    cv::Mat batch_blob;                         // Buffer de detectBatch()
+    
+    DetectorInput(const cv::Size& input_size, const std::string& path)
+        : size(input_size), model_path(path) {}
+};
+
+/**
+ * Callback de detección asíncrona
+ */
+using DetectionCallback = std::function<void(std::vector<PlateDetection> detections)>;
+
 /**
  * Detector de placas de vehículos usando YOLO
- * Soporta TensorRT (Jetson) y ONNX Runtime
+ * La inferencia se delega a un InferenceBackend (OpenCV DNN, ONNX Runtime, OpenVINO)
  */
 class PlateDetector {
 public:
@@ -33,9 +78,11 @@ public:
      * 
      * @param model_path Ruta al modelo (ONNX, TensorRT engine, o similar)
      * @param confidence_threshold Umbral de confianza mínimo (default: 0.3)
+     * @param options Opciones del backend de inferencia
      */
     explicit PlateDetector(const std::string& model_path, 
-                          float confidence_threshold = 0.3f);
+                          float confidence_threshold = 0.3f,
+                          const InferenceOptions& options = InferenceOptions());
     
     /**
      * Destructor
@@ -57,6 +104,78 @@ public:
      */
     std::vector<PlateDetection> detect(const cv::Mat& frame);
     
+    /**
+     * Detectar placas en varios frames con una sola inferencia
+     * 
+     * Construye un tensor N×3×H×W, ejecuta un único forward y separa
+     * las salidas por imagen. Si el modelo no admite batch dinámico,
+     * procesa los frames uno a uno.
+     * 
+     * @param frames Frames de entrada (cámaras distintas o recortes ROI)
+     * @return Detecciones por frame, en el mismo orden que la entrada
+     */
+    std::vector<std::vector<PlateDetection>> detectBatch(const std::vector<cv::Mat>& frames);
+    
+    /**
+     * Detectar placas de forma asíncrona
+     * 
+     * Preprocesa en el hilo llamador y retorna en cuanto la inferencia
+     * está en curso; el callback recibe las detecciones (posiblemente
+     * desde un hilo del runtime). Con backends síncronos el callback se
+     * ejecuta antes de retornar.
+     * 
+     * @param frame Frame de entrada
+     * @param callback Función que recibe las detecciones
+     * @return true si la inferencia se lanzó correctamente
+     */
+    bool detectAsync(const cv::Mat& frame, DetectionCallback callback);
+    
+    /**
+     * Verificar si el backend ejecuta inferencias asíncronas reales
+     */
+    bool supportsAsync() const;
+    
+    /**
+     * Esperar a que terminen las detecciones asíncronas en curso
+     */
+    void waitForPending();
+    
+    /**
+     * Agregar un tamaño de entrada (antes de initialize())
+     * 
+     * @param size Tamaño de entrada de la red (ej. 320×320)
+     * @param model_path Modelo exportado para ese tamaño; vacío para usar el
+     *                   modelo principal (debe tener forma dinámica)
+     */
+    void addInputSize(const cv::Size& size, const std::string& model_path = "");
+    
+    /**
+     * Reemplazar el tamaño de entrada por defecto (640×640) antes de initialize()
+     * 
+     * Para modelos que solo se usan a un tamaño: no se carga ni calienta el 640.
+     * 
+     * @param size Único tamaño de entrada de la red
+     */
+    void setPrimaryInputSize(const cv::Size& size);
+    
+    /**
+     * Seleccionar el tamaño de entrada para los siguientes frames
+     * 
+     * @param size Tamaño previamente agregado
+     * @return false si el tamaño no está configurado
+     */
+    bool setInputSize(const cv::Size& size);
+    
+    /**
+     * Obtener tamaño de entrada activo
+     */
+    cv::Size getInputSize() const;
+    
+    /**
+     * Obtener tamaños de entrada configurados (de menor a mayor)
+     */
+    std::vector<cv::Size> getInputSizes() const;
+    
     /**
      * Configurar umbral de confianza
      * 
@@ -74,53 +193,130 @@ public:
     float getConfidenceThreshold() const {
         return confidence_threshold_;
     }
+    
+    /**
+     * Configurar parámetros de NMS
+     * 
+     * @param config Configuración de NMS
+     */
+    void setNMSConfig(const NMSConfig& config) {
+        nms_.setConfig(config);
+    }
+    
+    /**
+     * Aceptar solo ciertas clases del modelo
+     * 
+     * @param class_ids Clases aceptadas (vacío = todas)
+     */
+    void setClassFilter(const std::vector<int>& class_ids);
+    
+    /**
+     * Obtener nombre del backend de inferencia activo
+     * 
+     * @return Nombre del backend o string vacío si no está inicializado
+     */
+    std::string getBackendName() const;
+    
+    /**
+     * Obtener ruta del modelo activo
+     */
+    std::string getModelPath() const;
+    
+    /**
+     * Reemplazar el modelo en caliente
+     * 
+     * Carga y calienta el modelo nuevo (todos los tamaños de entrada) en el
+     * hilo llamador mientras el actual sigue detectando, y lo activa entre
+     * dos detecciones. Si la carga o el calentamiento fallan, el modelo
+     * actual se mantiene.
+     * 
+     * @param model_path Ruta al modelo nuevo (puede ser la misma ruta, reescrita)
+     * @return true si el modelo nuevo quedó activo
+     */
+    bool reloadModel(const std::string& model_path);
+    
+    /**
+     * Preprocesar frame para inferencia
+     * Público para que la calibración INT8 use exactamente el mismo tensor
+     * 
+     * @param frame Frame de entrada
+     * @param blob Blob de salida (1×3×H×W, float32, tamaño de entrada activo)
+     */
+    void preprocess(const cv::Mat& frame, cv::Mat& blob);
 
 private:
     std::string model_path_;
     float confidence_threshold_;
     
     bool initialized_;
+    bool batch_supported_;      // false si el modelo rechazó un batch > 1 al calentar
     
-    // Para OpenCV DNN (ONNX)
-    cv::dnn::Net net_;
+    // Backend de inferencia y buffers por tamaño de entrada (de menor a mayor)
+    // model_mutex_: compartido por cada detección, exclusivo al reemplazar el modelo
+    InferenceOptions inference_options_;
+    std::vector<DetectorInput> inputs_;
+    mutable std::shared_mutex model_mutex_;
+    std::atomic<size_t> active_input_;
     
     // Configuración del modelo
-    cv::Size input_size_;
     float scale_factor_;
     cv::Scalar mean_;
     bool swap_rb_;
     
+    // Clases aceptadas por índice (vacío = todas)
+    std::vector<bool> class_filter_;
+    
+    // Buffers reutilizables entre frames (decodificación + NMS sin asignaciones)
+    CandidateBuffer candidates_;
+    FastNMS nms_;
+    std::mutex postprocess_mutex_;  // Callbacks asíncronos comparten candidates_/nms_
+    
     /**
-     * Preprocesar frame para inferencia
+     * Cargar y calentar un backend por tamaño de entrada
      * 
-     * @param frame Frame de entrada
-     * @param blob Blob de salida
+     * @param inputs Tamaños a cargar (se descartan los que el modelo rechaza)
+     * @param model_path Modelo principal
+     * @param strict Fallar si cualquier tamaño no pasa el calentamiento
+     * @return true si quedó al menos un tamaño (todos si strict)
      */
-    void preprocess(const cv::Mat& frame, cv::Mat& blob);
+    bool loadInputs(std::vector<DetectorInput>& inputs, const std::string& model_path, bool strict);
+    
+    /**
+     * Probar si el modelo acepta un batch > 1 (calentamiento con 2 frames)
+     * 
+     * @param input Tamaño de entrada ya cargado
+     * @return false si el modelo se exportó con batch fijo
+     */
+    bool probeBatch(DetectorInput& input);
+    
+    /**
+     * Detectar con model_mutex_ ya tomado
+     */
+    std::vector<PlateDetection> detectLocked(const cv::Mat& frame);
     
     /**
      * Postprocesar resultados de inferencia
+     * Decodifica los candidatos que superan el umbral en candidates_
      * 
      * @param outputs Outputs del modelo
      * @param frame_size Tamaño original del frame
-     * @return Vector de detecciones
+     * @param input_size Tamaño de entrada usado en la inferencia
+     * @param batch_index Índice de la imagen dentro del batch (default: 0)
      */
-    std::vector<PlateDetection> postprocess(
+    void postprocess(
         const std::vector<cv::Mat>& outputs,
-        const cv::Size& frame_size
+        const cv::Size& frame_size,
+        const cv::Size& input_size,
+        int batch_index = 0
     );
     
     /**
-     * Aplicar NMS (Non-Maximum Suppression)
+     * Aplicar NMS (Non-Maximum Suppression) sobre candidates_
      * 
-     * @param detections Detecciones de entrada
-     * @param nms_threshold Umbral NMS (default: 0.5)
+     * @param frame_size Tamaño original del frame (para recortar bboxes)
      * @return Detecciones después de NMS
      */
-    std::vector<PlateDetection> applyNMS(
-        const std::vector<PlateDetection>& detections,
-        float nms_threshold = 0.5f
-    );
+    std::vector<PlateDetection> applyNMS(const cv::Size& frame_size);
 };
 
 } // namespace jetson_lpr
@@ -0,0 +1,139 @@
+#ifndef FIXED_FONT_RECOGNIZER_H
+#define FIXED_FONT_RECOGNIZER_H
+
+#include <string>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+#include "plate_recognizer.h"
+#include "binarization_scorer.h"
+
+namespace jetson_lpr {
+
+/**
+ * Parámetros del reconocedor de fuente fija
+ */
+struct FixedFontConfig {
+    std::string templates_path; // Plantillas de glifos (YAML); si no existe, se dibujan
+    int k;                      // Vecinos que votan (default: 3)
+    int plate_height;           // Alto al que se normaliza la placa (default: 64)
+
+    FixedFontConfig()
+        : templates_path("models/plate_glyphs.yml")
+        , k(3)
+        , plate_height(64)
+    {}
+};
+
+/**
+ * Reconocedor rápido para la fuente y disposición fijas de las placas
+ * colombianas
+ *
+ * La placa se normaliza en alto y se binariza (Otsu y adaptativo); de la
+ * binarización mejor puntuada se toma la fila de caracteres alineados
+ * (BinarizationScorer::segment), que deja fuera la ciudad y el marco.
+ * Solo se aceptan filas de 6 caracteres, las que PlateValidator admite
+ * (ABC123, CD1234). Cada glifo se centra en un cuadrado, se reduce a
+ * 20x20 y se clasifica por kNN (similitud coseno) contra plantillas del
+ * alfabeto de su posición: letras en las tres primeras y dígitos en el
+ * resto (la tercera puede ser dígito tras "CD"), así 0/O y 1/I no se
+ * confunden.
+ *
+ * No reemplaza al OCR: OCRProcessor lo usa como ruta rápida y solo acepta
+ * su lectura con formato válido y confianza alta.
+ *
+ * Thread-safe después de initialize(), salvo addSample().
+ */
+class FixedFontRecognizer : public PlateRecognizer {
+public:
+    static constexpr int GLYPH_SIZE = 20;
+
+    explicit FixedFontRecognizer(const FixedFontConfig& config = FixedFontConfig());
+
+    bool initialize() override;
+
+    std::vector<OCRResult> recognizeBatch(const std::vector<cv::Mat>& plates) override;
+
+    std::string name() const override;
+
+    /**
+     * Reconocer una placa
+     *
+     * @param plate Recorte de la placa (color o gris)
+     * @return Texto con la confianza de cada carácter (vacío si no se segmentó)
+     */
+    OCRResult recognize(const cv::Mat& plate) const;
+
+    /**
+     * Segmentar los caracteres de la placa
+     *
+     * @param plate Recorte de la placa
+     * @param foreground Placa normalizada con los caracteres en 255
+     * @param boxes Caracteres sobre foreground, de izquierda a derecha
+     * @return true si la fila tiene 6 caracteres
+     */
+    bool segment(const cv::Mat& plate, cv::Mat& foreground, std::vector<cv::Rect>& boxes) const;
+
+    /**
+     * Vector de características de un glifo (20x20, norma 1)
+     *
+     * @param foreground Imagen con los caracteres en 255
+     * @param box Caja del carácter
+     * @return Fila CV_32F de GLYPH_SIZE² valores
+     */
+    static cv::Mat glyphFeatures(const cv::Mat& foreground, const cv::Rect& box);
+
+    /**
+     * Agregar una plantilla (para construir el archivo con placas etiquetadas)
+     *
+     * @param features Resultado de glyphFeatures()
+     * @param label Carácter (A-Z o 0-9)
+     */
+    void addSample(const cv::Mat& features, char label);
+
+    /**
+     * Guardar las plantillas en YAML
+     *
+     * @param path Ruta del archivo
+     * @return true si se guardó
+     */
+    bool saveTemplates(const std::string& path) const;
+
+    /**
+     * Plantillas por alfabeto
+     */
+    size_t letterCount() const { return letters_.labels.size(); }
+    size_t digitCount() const { return digits_.labels.size(); }
+
+private:
+    struct Alphabet {
+        cv::Mat samples;            // Una fila por plantilla
+        std::vector<char> labels;
+    };
+
+    FixedFontConfig config_;
+    Alphabet letters_;
+    Alphabet digits_;
+    BinarizationScorer scorer_;
+    bool initialized_;
+
+    bool loadTemplates(const std::string& path);
+
+    /**
+     * Plantillas dibujadas con las fuentes Hershey (aproximación de la
+     * fuente de las placas, para arrancar sin archivo)
+     */
+    void renderTemplates();
+
+    /**
+     * Clasificar un glifo por voto ponderado de los k vecinos
+     *
+     * @param confidence Fracción del voto del ganador por su similitud
+     * @return Carácter ganador (0 si el alfabeto está vacío)
+     */
+    char classify(const Alphabet& alphabet, const cv::Mat& features, float& confidence) const;
+};
+
+} // namespace jetson_lpr
+
+#endif // FIXED_FONT_RECOGNIZER_H
@@ -0,0 +1,137 @@
+#ifndef INFERENCE_BACKEND_H
+#define INFERENCE_BACKEND_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <opencv2/opencv.hpp>
+
+namespace jetson_lpr {
+
+/**
+ * Opciones de inferencia comunes a todos los backends
+ */
+struct InferenceOptions {
+    std::string backend;                // "opencv", "onnxruntime", "openvino"
+    int intra_op_threads;               // Hilos dentro de un operador (0 = automático)
+    int inter_op_threads;               // Hilos entre operadores (0 = automático)
+    bool graph_optimization;            // Optimizaciones de grafo del runtime
+    std::string optimized_model_cache;  // Ruta donde cachear el grafo optimizado ("" = sin cache)
+    bool use_cuda;                      // Intentar aceleración CUDA si está disponible
+    std::string device;                 // Dispositivo OpenVINO ("CPU", "GPU", "AUTO")
+    int num_requests;                   // Solicitudes de inferencia simultáneas (async)
+    std::string precision;              // "auto", "fp32", "fp16" o "int8" (modelo QDQ)
+
+    InferenceOptions()
+        : backend("opencv")
+        , intra_op_threads(0)
+        , inter_op_threads(0)
+        , graph_optimization(true)
+        , use_cuda(true)
+        , device("CPU")
+        , num_requests(4)
+        , precision("auto")
+    {}
+};
+
+/**
+ * Callback de inferencia asíncrona
+ *
+ * @param ok true si la inferencia fue correcta
+ * @param outputs Salidas del modelo (válidas solo durante el callback)
+ */
+using InferenceCallback = std::function<void(bool ok, std::vector<cv::Mat>& outputs)>;
+
+/**
+ * Interfaz de backend de inferencia
+ *
+ * Recibe un blob NCHW float32 ya preprocesado y devuelve las salidas
+ * del modelo como cv::Mat N-dimensionales float32. Las salidas pueden
+ * apuntar a buffers internos del backend: son válidas hasta la
+ * siguiente llamada a infer().
+ *
+ * Las implementaciones no son thread-safe.
+ */
+class InferenceBackend {
+public:
+    virtual ~InferenceBackend() = default;
+
+    /**
+     * Cargar modelo
+     *
+     * @param model_path Ruta al modelo
+     * @return true si se cargó correctamente
+     */
+    virtual bool load(const std::string& model_path) = 0;
+
+    /**
+     * Ejecutar inferencia
+     *
+     * @param blob Tensor de entrada NCHW float32
+     * @param outputs Salidas del modelo
+     * @return true si la inferencia fue correcta
+     */
+    virtual bool infer(const cv::Mat& blob, std::vector<cv::Mat>& outputs) = 0;
+
+    /**
+     * Nombre del backend (para logs)
+     */
+    virtual std::string name() const = 0;
+
+    /**
+     * Indica si el backend ejecuta inferAsync() realmente en segundo plano
+     */
+    virtual bool supportsAsync() const { return false; }
+
+    /**
+     * Lanzar inferencia asíncrona
+     *
+     * El blob se copia antes de retornar, así que el llamador puede
+     * reutilizarlo para preprocesar el siguiente frame. Si no hay
+     * solicitudes libres, bloquea hasta que termine alguna. El callback
+     * puede ejecutarse en un hilo del runtime.
+     *
+     * La implementación por defecto es síncrona.
+     *
+     * @param blob Tensor de entrada NCHW float32
+     * @param callback Función a llamar al completar
+     * @return true si se lanzó correctamente
+     */
+    virtual bool inferAsync(const cv::Mat& blob, InferenceCallback callback) {
+        std::vector<cv::Mat> outputs;
+        bool ok = infer(blob, outputs);
+        callback(ok, outputs);
+        return ok;
+    }
+
+    /**
+     * Esperar a que terminen todas las inferencias asíncronas en curso
+     */
+    virtual void waitAll() {}
+};
+
+/**
+ * Detectar la precisión de un modelo ONNX
+ *
+ * Un modelo cuantizado en formato QDQ contiene nodos
+ * QuantizeLinear/DequantizeLinear.
+ *
+ * @param model_path Ruta al modelo
+ * @return "int8" si el modelo está cuantizado, "fp32" en otro caso
+ */
+std::string detectModelPrecision(const std::string& model_path);
+
+/**
+ * Crear backend de inferencia según las opciones
+ *
+ * Si el backend pedido no se compiló, se usa OpenCV DNN.
+ *
+ * @param options Opciones de inferencia
+ * @return Backend creado
+ */
+std::unique_ptr<InferenceBackend> createInferenceBackend(const InferenceOptions& options);
+
+} // namespace jetson_lpr
+
+#endif // INFERENCE_BACKEND_H
@@ -0,0 +1,69 @@
+#ifndef INPUT_SIZE_SELECTOR_H
+#define INPUT_SIZE_SELECTOR_H
+
+#include "detector.h"
+
+#include <vector>
+#include <deque>
+#include <cstdint>
+#include <opencv2/opencv.hpp>
+
+namespace jetson_lpr {
+
+/**
+ * Selector del tamaño de entrada del detector por frame
+ *
+ * Registra la altura relativa (alto de placa / alto de frame) de las
+ * placas detectadas recientemente y elige el menor tamaño de entrada en el
+ * que la placa más pequeña seguiría midiendo al menos min_plate_px en la
+ * red. Sin placas recientes usa el tamaño mayor, y cada probe_interval
+ * frames fuerza el mayor para no perder vehículos lejanos que entran.
+ */
+class InputSizeSelector {
+public:
+    /**
+     * Constructor
+     *
+     * @param sizes Tamaños de entrada disponibles (de menor a mayor)
+     * @param min_plate_px Altura mínima de placa en la entrada de la red (default: 16)
+     * @param window_frames Frames que se recuerda cada placa (default: 30)
+     * @param probe_interval Frames entre sondeos con el tamaño mayor (default: 15)
+     */
+    explicit InputSizeSelector(const std::vector<cv::Size>& sizes,
+                               float min_plate_px = 16.0f,
+                               int window_frames = 30,
+                               int probe_interval = 15);
+
+    /**
+     * Registrar las detecciones de un frame
+     *
+     * @param detections Detecciones en coordenadas de frame
+     * @param frame_size Tamaño del frame donde se detectó
+     */
+    void report(const std::vector<PlateDetection>& detections, const cv::Size& frame_size);
+
+    /**
+     * Elegir tamaño de entrada para el siguiente frame
+     *
+     * @return Tamaño de entrada
+     */
+    cv::Size select();
+
+private:
+    struct Observation {
+        uint64_t frame;
+        float relative_height;
+    };
+
+    std::vector<cv::Size> sizes_;
+    float min_plate_px_;
+    uint64_t window_frames_;
+    uint64_t probe_interval_;
+
+    std::deque<Observation> recent_;
+    uint64_t frame_count_;
+};
+
+} // namespace jetson_lpr
+
+#endif // INPUT_SIZE_SELECTOR_H
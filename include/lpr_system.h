@@ -4,6 +4,15 @@
 #include "config_manager.h"
 #include "video_capture.h"
 #include "detector.h"
+#include "detection_batcher.h"
+#include "tiled_detector.h"
+#include "input_size_selector.h"
+#include "detection_cascade.h"
+#include "model_reloader.h"
+#include "plate_prefilter.h"
+#include "plate_voter.h"
+#include "plate_rectifier.h"
+#include "startup_timeline.h"
 #include "ocr_processor.h"
 #include "plate_validator.h"
 #include "database_manager.h"
@@ -28,6 +37,7 @@ struct DetectionResult {
     float ocr_confidence;              // Confianza de OCR
     cv::Rect plate_bbox;               // Bounding box de la placa
     cv::Rect vehicle_bbox;             // Bounding box del vehículo (opcional)
+    std::string plate_type;            // Tipo según color de fondo (prefiltro)
     std::chrono::system_clock::time_point timestamp;  // Timestamp de detección
     
     bool valid;                         // Si la placa es válida (formato colombiano)
@@ -83,6 +93,13 @@ public:
      */
     bool isRunning() const { return running_; }
     
+    /**
+     * Solicitar recarga del modelo del detector sin detener el sistema
+     * 
+     * @param model_path Modelo nuevo; vacío para recargar el archivo actual
+     */
+    void requestModelReload(const std::string& model_path = "");
+    
     /**
      * Estructura de estadísticas del sistema
      */
@@ -93,6 +110,20 @@ public:
         double capture_fps;             // FPS de captura
         double ai_fps;                  // FPS de procesamiento IA
         double average_latency_ms;      // Latencia promedio (ms)
+        uint64_t prefilter_rejected_size;    // Descartes del prefiltro por tamaño
+        uint64_t prefilter_rejected_aspect;  // ... por relación de aspecto
+        uint64_t prefilter_rejected_edge;    // ... por borde del frame
+        uint64_t prefilter_rejected_color;   // ... por color de fondo
+        double time_to_first_decision_ms;    // Lanzamiento → primer frame analizado (0 = aún no)
+        OCRStrategyStats::Summary ocr_strategies;  // Victorias por binarización e intentos promedio
+        OCRResultCache::Stats ocr_cache;           // Aciertos del cache de OCR
+        uint64_t rectified_estimated;        // Placas rectificadas con contorno propio
+        uint64_t rectified_cached;           // ... con la geometría del carril
+        uint64_t rectified_passthrough;      // ... sin geometría (recorte sin rectificar)
+        uint64_t voting_tracks;              // Vehículos seguidos por la votación
+        uint64_t voting_emitted;             // Placas emitidas por consenso
+        uint64_t voting_expired;             // Placas emitidas por mayoría al perder el vehículo
+        uint64_t voting_skipped;             // Lecturas de OCR evitadas (vehículo ya decidido)
     };
     
     /**
@@ -105,6 +136,15 @@ private:
     
     std::unique_ptr<VideoCapture> video_capture_;
     std::unique_ptr<PlateDetector> detector_;
+    std::unique_ptr<DetectionBatcher> detection_batcher_;  // Opcional (varias fuentes)
+    std::unique_ptr<TiledDetector> tiled_detector_;        // Opcional (placas lejanas)
+    std::unique_ptr<InputSizeSelector> input_size_selector_;  // Opcional (tamaño por frame)
+    std::unique_ptr<PlateDetector> vehicle_detector_;         // Opcional (cascada)
+    std::unique_ptr<DetectionCascade> detection_cascade_;
+    std::unique_ptr<ModelReloader> model_reloader_;           // Recarga en caliente
+    std::unique_ptr<PlatePrefilter> plate_prefilter_;         // Opcional (antes del OCR)
+    std::unique_ptr<PlateRectifier> plate_rectifier_;         // Opcional (perspectiva antes del OCR)
+    std::unique_ptr<PlateVoter> plate_voter_;                 // Opcional (consenso entre frames)
     std::unique_ptr<OCRProcessor> ocr_processor_;
     std::unique_ptr<DatabaseManager> db_manager_;
     
@@ -124,6 +164,16 @@ private:
     std::queue<DetectionResult> result_queue_;
     std::mutex result_queue_mutex_;
     
+    // Detecciones asíncronas completadas (pendientes de OCR)
+    struct CompletedFrame {
+        cv::Mat frame;                          // Frame original
+        cv::Size processing_size;               // Tamaño del frame usado para detección
+        std::vector<PlateDetection> detections; // En coordenadas del frame reducido
+    };
+    std::queue<CompletedFrame> completed_frames_;
+    std::mutex completed_frames_mutex_;
+    bool async_detection_;
+    
     // Estadísticas
     mutable std::mutex stats_mutex_;
     Stats stats_;
@@ -132,12 +182,17 @@ private:
     std::unordered_map<std::string, std::chrono::system_clock::time_point> detection_cooldown_;
     std::mutex cooldown_mutex_;
     double cooldown_seconds_;
+    bool ocr_cache_enabled_;
     
     // Contadores
     uint64_t frame_counter_;
     uint64_t ai_frame_counter_;
     uint64_t detection_counter_;
     
+    // Arranque: pasos de inicialización y primera decisión
+    StartupTimeline startup_timeline_;
+    bool first_decision_done_;
+    
     // Tiempo de inicio
     std::chrono::steady_clock::time_point start_time_;
     
@@ -146,6 +201,14 @@ private:
     double display_scale_;
     std::string window_name_;
     
+    /**
+     * Crear y cargar el detector de vehículos de la cascada
+     * 
+     * @param inference_options Backend compartido con el detector de placas
+     * @return true si se cargó el modelo
+     */
+    bool initializeVehicleDetector(const InferenceOptions& inference_options);
+    
     /**
      * Hilo de captura de frames
      */
@@ -159,10 +222,56 @@ private:
     /**
      * Procesar un frame completo
      * 
-     * @param frame Frame de entrada
+     * @param frame Frame original (recortes para OCR)
+     * @param processing_frame Frame reducido para la detección
+     * @return Resultados de detección en coordenadas del frame original
+     */
+    std::vector<DetectionResult> processFrame(const cv::Mat& frame,
+                                              const cv::Mat& processing_frame);
+    
+    /**
+     * Procesar un frame combinando detección completa y por teselas
+     * 
+     * @param frame Frame original (teselas y OCR a resolución nativa)
+     * @param processing_frame Frame reducido para la detección completa
+     * @return Resultados de detección en coordenadas del frame original
+     */
+    std::vector<DetectionResult> processFrameTiled(const cv::Mat& frame,
+                                                   const cv::Mat& processing_frame);
+    
+    /**
+     * Procesar un frame con la cascada vehículo → placa
+     * 
+     * @param frame Frame original
+     * @return Resultados con vehicle_bbox, en coordenadas del frame original
+     */
+    std::vector<DetectionResult> processFrameCascade(const cv::Mat& frame);
+    
+    /**
+     * Reconocer y validar las detecciones de un frame
+     * 
+     * @param frame Frame original (de aquí se recortan las placas)
+     * @param detections Detecciones de placas en coordenadas del frame original
+     * @param vehicle_boxes Vehículo de cada detección (vacío si no hay cascada)
      * @return Resultados de detección
      */
-    std::vector<DetectionResult> processFrame(const cv::Mat& frame);
+    std::vector<DetectionResult> processDetections(const cv::Mat& frame,
+                                                   const std::vector<PlateDetection>& detections,
+                                                   const std::vector<cv::Rect>& vehicle_boxes = {});
+    
+    /**
+     * Registrar, guardar y mostrar los resultados de un frame
+     * 
+     * @param frame Frame original
+     * @param results Resultados de detección en coordenadas del frame original
+     */
+    void handleResults(const cv::Mat& frame,
+                       const std::vector<DetectionResult>& results);
+    
+    /**
+     * Procesar las detecciones asíncronas completadas
+     */
+    void drainCompletedFrames();
     
     /**
      * Guardar detección en base de datos
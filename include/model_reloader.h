@@ -0,0 +1,104 @@
+#ifndef MODEL_RELOADER_H
+#define MODEL_RELOADER_H
+
+#include "detector.h"
+
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+
+namespace jetson_lpr {
+
+/**
+ * Recarga del modelo del detector en segundo plano
+ *
+ * Un hilo propio atiende las solicitudes de recarga (comando de control,
+ * p. ej. SIGUSR1) y, opcionalmente, vigila el archivo del modelo: cuando su
+ * fecha de modificación cambia y el tamaño se mantiene estable entre dos
+ * sondeos (copia terminada), llama a PlateDetector::reloadModel(). La
+ * captura RTSP, Tesseract y MySQL no se tocan.
+ */
+class ModelReloader {
+public:
+    /**
+     * Constructor
+     *
+     * @param detector Detector cuyo modelo se reemplaza
+     * @param watch_file Vigilar cambios en el archivo del modelo activo
+     * @param poll_interval_sec Intervalo de sondeo del archivo (default: 2 s)
+     */
+    ModelReloader(PlateDetector& detector, bool watch_file, double poll_interval_sec = 2.0);
+
+    /**
+     * Destructor
+     */
+    ~ModelReloader();
+
+    /**
+     * Iniciar hilo de recarga
+     */
+    void start();
+
+    /**
+     * Detener hilo de recarga (espera a que termine una recarga en curso)
+     */
+    void stop();
+
+    /**
+     * Solicitar recarga (no bloquea)
+     *
+     * @param model_path Modelo nuevo; vacío para recargar la ruta activa
+     */
+    void requestReload(const std::string& model_path = "");
+
+    /**
+     * Obtener número de recargas exitosas / fallidas (revertidas)
+     */
+    uint64_t getReloadCount() const { return reloads_ok_; }
+    uint64_t getRollbackCount() const { return reloads_failed_; }
+
+private:
+    PlateDetector& detector_;
+    bool watch_file_;
+    std::chrono::milliseconds poll_interval_;
+
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<bool> running_;
+
+    bool reload_requested_;
+    std::string requested_path_;
+
+    // Estado del archivo vigilado
+    std::string watched_path_;
+    int64_t last_mtime_;
+    int64_t pending_size_;
+
+    std::atomic<uint64_t> reloads_ok_;
+    std::atomic<uint64_t> reloads_failed_;
+
+    /**
+     * Hilo de recarga
+     */
+    void reloadWorker();
+
+    /**
+     * Revisar el archivo del modelo
+     *
+     * @return true si cambió y ya terminó de escribirse
+     */
+    bool checkModelFile();
+
+    /**
+     * Recordar la fecha de modificación actual del modelo activo
+     */
+    void snapshotModelFile();
+};
+
+} // namespace jetson_lpr
+
+#endif // MODEL_RELOADER_H
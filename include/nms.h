@@ -0,0 +1,147 @@
+#ifndef NMS_H
+#define NMS_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace jetson_lpr {
+
+/**
+ * Buffer de candidatos en formato estructura-de-arreglos (SoA)
+ *
+ * El decodificador escribe aquí directamente. clear() conserva la
+ * capacidad reservada, así que reutilizarlo entre frames no asigna memoria.
+ */
+struct CandidateBuffer {
+    std::vector<float> x1;          // Esquina superior izquierda
+    std::vector<float> y1;
+    std::vector<float> x2;          // Esquina inferior derecha
+    std::vector<float> y2;
+    std::vector<float> scores;      // Confianza del candidato
+    std::vector<int> class_ids;     // ID de clase
+
+    void reserve(size_t capacity) {
+        x1.reserve(capacity);
+        y1.reserve(capacity);
+        x2.reserve(capacity);
+        y2.reserve(capacity);
+        scores.reserve(capacity);
+        class_ids.reserve(capacity);
+    }
+
+    void clear() {
+        x1.clear();
+        y1.clear();
+        x2.clear();
+        y2.clear();
+        scores.clear();
+        class_ids.clear();
+    }
+
+    size_t size() const { return scores.size(); }
+
+    bool empty() const { return scores.empty(); }
+
+    void push(float bx1, float by1, float bx2, float by2, float score, int class_id) {
+        x1.push_back(bx1);
+        y1.push_back(by1);
+        x2.push_back(bx2);
+        y2.push_back(by2);
+        scores.push_back(score);
+        class_ids.push_back(class_id);
+    }
+};
+
+/**
+ * Parámetros de NMS
+ */
+struct NMSConfig {
+    float iou_threshold;        // IoU a partir del cual se suprime (default: 0.5)
+    int top_k;                  // Candidatos considerados tras ordenar (0 = todos)
+    int max_detections;         // Máximo de detecciones devueltas (0 = sin límite)
+    bool class_aware;           // Solo suprimir entre cajas de la misma clase
+    bool soft_nms;              // Soft-NMS gaussiano en lugar de supresión dura
+    float soft_sigma;           // Sigma del decaimiento gaussiano (soft-NMS)
+    float soft_min_score;       // Score mínimo tras el decaimiento (soft-NMS)
+
+    NMSConfig()
+        : iou_threshold(0.5f)
+        , top_k(300)
+        , max_detections(100)
+        , class_aware(false)
+        , soft_nms(false)
+        , soft_sigma(0.5f)
+        , soft_min_score(0.001f)
+    {}
+};
+
+/**
+ * Non-Maximum Suppression rápido sobre buffers SoA
+ *
+ * - Ordenamiento parcial de los top-K candidatos por score
+ * - IoU de una caja contra 4 a la vez (SSE2 / NEON, escalar como respaldo)
+ * - Supresión dura o soft-NMS, opcionalmente por clase
+ *
+ * Todos los buffers internos se reservan una vez y se reutilizan;
+ * en régimen estable run() no asigna memoria.
+ */
+class FastNMS {
+public:
+    explicit FastNMS(const NMSConfig& config = NMSConfig());
+
+    /**
+     * Reservar buffers internos para un número máximo de candidatos
+     *
+     * @param max_candidates Número máximo esperado de candidatos
+     */
+    void reserve(size_t max_candidates);
+
+    /**
+     * Ejecutar NMS
+     *
+     * En modo soft-NMS los scores de los candidatos conservados se
+     * actualizan en candidates.scores.
+     *
+     * @param candidates Candidatos decodificados
+     * @return Índices (en candidates) de las detecciones conservadas,
+     *         ordenados por score descendente. Válido hasta la siguiente llamada.
+     */
+    const std::vector<int>& run(CandidateBuffer& candidates);
+
+    void setConfig(const NMSConfig& config) { config_ = config; }
+
+    const NMSConfig& getConfig() const { return config_; }
+
+private:
+    NMSConfig config_;
+
+    // Índices ordenados y resultado
+    std::vector<int> order_;
+    std::vector<int> keep_;
+
+    // Copia compacta de los top-K en orden de score (contigua para SIMD)
+    std::vector<float> sx1_, sy1_, sx2_, sy2_;
+    std::vector<float> sarea_;
+    std::vector<float> sscore_;
+    std::vector<int> sclass_;
+    std::vector<float> iou_;
+    std::vector<uint8_t> suppressed_;
+
+    /**
+     * Calcular IoU de la caja i contra las cajas [begin, end) del buffer compacto
+     *
+     * @param i Índice de la caja de referencia
+     * @param begin Primer índice a comparar
+     * @param end Índice final (exclusivo)
+     * @param out Salida: out[j] = IoU(i, j)
+     */
+    void computeIoU(int i, int begin, int end, float* out) const;
+
+    void runHard(int count);
+    void runSoft(int count, CandidateBuffer& candidates);
+};
+
+} // namespace jetson_lpr
+
+#endif // NMS_H
@@ -0,0 +1,116 @@
+#ifndef OCR_ENGINE_POOL_H
+#define OCR_ENGINE_POOL_H
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+// Forward declaration de Tesseract
+namespace tesseract {
+    class TessBaseAPI;
+}
+
+namespace jetson_lpr {
+
+/**
+ * Pool de instancias de Tesseract
+ *
+ * TessBaseAPI no es thread-safe, así que cada hilo que hace OCR necesita
+ * su propia instancia. El pool crea N instancias inicializadas en paralelo
+ * al arranque y las presta con lease(): la toma y la devolución son un
+ * compare-and-swap sobre el slot, sin lock global; solo cuando todas están
+ * ocupadas el hilo espera en una variable de condición.
+ */
+class OCREnginePool {
+public:
+    /**
+     * Instancia prestada; se devuelve al pool al destruirse
+     */
+    class Lease {
+    public:
+        Lease() : pool_(nullptr), slot_(0) {}
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease();
+
+        tesseract::TessBaseAPI& operator*() const;
+        tesseract::TessBaseAPI* operator->() const;
+        explicit operator bool() const { return pool_ != nullptr; }
+
+    private:
+        friend class OCREnginePool;
+        Lease(OCREnginePool* pool, size_t slot) : pool_(pool), slot_(slot) {}
+
+        OCREnginePool* pool_;
+        size_t slot_;
+    };
+
+    /**
+     * Función que inicializa y configura una instancia (Init, PSM, variables)
+     */
+    using EngineSetup = std::function<bool(tesseract::TessBaseAPI&)>;
+
+    /**
+     * Constructor
+     *
+     * @param size Número de instancias (0 = núcleos disponibles, máximo 4)
+     */
+    explicit OCREnginePool(size_t size = 0);
+
+    /**
+     * Destructor (libera las instancias; no debe haber préstamos activos)
+     */
+    ~OCREnginePool();
+
+    /**
+     * Crear e inicializar todas las instancias en paralelo
+     *
+     * @param setup Inicialización de cada instancia
+     * @return true si al menos una instancia quedó lista
+     */
+    bool initialize(const EngineSetup& setup);
+
+    /**
+     * Tomar una instancia libre (espera si todas están ocupadas)
+     */
+    Lease lease();
+
+    /**
+     * Tomar una instancia libre sin esperar
+     *
+     * @return Préstamo vacío si todas están ocupadas
+     */
+    Lease tryLease();
+
+    /**
+     * Número de instancias listas
+     */
+    size_t size() const { return engines_.size(); }
+
+private:
+    size_t requested_size_;
+    std::vector<std::unique_ptr<tesseract::TessBaseAPI>> engines_;
+    std::unique_ptr<std::atomic<bool>[]> busy_;
+
+    // Punto de partida de la búsqueda (reparte los préstamos entre slots)
+    std::atomic<size_t> next_slot_;
+
+    // Solo para esperar cuando el pool está agotado
+    std::mutex wait_mutex_;
+    std::condition_variable available_;
+    std::atomic<int> waiters_;
+
+    /**
+     * Devolver una instancia
+     */
+    void release(size_t slot);
+};
+
+} // namespace jetson_lpr
+
+#endif // OCR_ENGINE_POOL_H
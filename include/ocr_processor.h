@@ -3,32 +3,36 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <memory>
-#include <unordered_map>
 #include <mutex>
 #include <opencv2/opencv.hpp>
 
-// Forward declaration de Tesseract
+#include "ocr_result.h"
+#include "ocr_result_cache.h"
+#include "ocr_engine_pool.h"
+#include "ocr_strategy_stats.h"
+#include "threshold_bank.h"
+#include "binarization_scorer.h"
+#include "plate_recognizer.h"
+#include "plate_layout_decoder.h"
+#include "text_band_extractor.h"
+
 namespace tesseract {
-    class TessBaseAPI;
+    class ETEXT_DESC;
 }
 
 namespace jetson_lpr {
 
-/**
- * Estructura para resultado de OCR
- */
-struct OCRResult {
-    std::string text;          // Texto reconocido
-    float confidence;          // Confianza (0.0 - 1.0)
-    
-    OCRResult() : confidence(0.0f) {}
-    OCRResult(const std::string& t, float c) : text(t), confidence(c) {}
-};
-
 /**
  * Procesador OCR usando Tesseract
  * Optimizado para reconocimiento de placas colombianas
+ * 
+ * Con un reconocedor configurado (setRecognizer) las placas se leen con él
+ * en lugar de Tesseract; el cache y el umbral de confianza se aplican igual.
+ * 
+ * Thread-safe: cada reconocimiento toma prestada una instancia de Tesseract
+ * del pool, así varios hilos pueden leer placas a la vez.
  */
 class OCRProcessor {
 public:
@@ -37,15 +41,42 @@ public:
      * 
      * @param language Idioma para OCR (default: "eng")
      * @param data_path Ruta al directorio de datos de Tesseract (opcional)
+     * @param num_engines Instancias de Tesseract (0 = según núcleos, máximo 4)
      */
     explicit OCRProcessor(const std::string& language = "eng", 
-                         const std::string& data_path = "");
+                         const std::string& data_path = "",
+                         size_t num_engines = 0);
     
     /**
      * Destructor
      */
     ~OCRProcessor();
     
+    /**
+     * Usar un reconocedor en lugar de Tesseract (antes de initialize())
+     * 
+     * Si el reconocedor no se puede inicializar se usa Tesseract.
+     * 
+     * @param recognizer Reconocedor (nullptr = Tesseract)
+     */
+    void setRecognizer(std::unique_ptr<PlateRecognizer> recognizer) {
+        recognizer_ = std::move(recognizer);
+    }
+    
+    /**
+     * Probar un reconocedor rápido antes del OCR (antes de initialize())
+     * 
+     * Su lectura se acepta sin OCR si tiene formato de placa válido y al
+     * menos accept_confidence; si no, la placa sigue al OCR normal.
+     * 
+     * @param recognizer Reconocedor rápido (nullptr = sin ruta rápida)
+     * @param accept_confidence Confianza mínima para aceptar (default: 0.8)
+     */
+    void setFastPath(std::unique_ptr<PlateRecognizer> recognizer, float accept_confidence = 0.8f) {
+        fast_path_ = std::move(recognizer);
+        fast_accept_confidence_ = accept_confidence;
+    }
+    
     /**
      * Inicializar procesador OCR
      * 
@@ -65,10 +96,33 @@ public:
     /**
      * Reconocer texto con múltiples intentos (diferentes preprocesamientos)
      * 
+     * Las binarizaciones se prueban en el orden que más acierta en esta
+     * cámara y franja horaria, repartidas entre las instancias libres del
+     * pool, y se detienen en cuanto una supera la confianza objetivo o da
+     * una placa con formato válido y confianza suficiente. En modo
+     * determinista se prueban en el orden fijo con una sola instancia
+     * (resultado reproducible para benchmarks).
+     * 
+     * Con cache, una placa parecida (hash perceptual cercano) ya leída con
+     * confianza suficiente se devuelve sin llamar a Tesseract.
+     * 
      * @param plate_image Imagen de la placa
+     * @param use_cache Si usar cache de resultados (default: true)
      * @return Mejor resultado de OCR
      */
-    OCRResult recognizeMultipleAttempts(const cv::Mat& plate_image);
+    OCRResult recognizeMultipleAttempts(const cv::Mat& plate_image, bool use_cache = true);
+    
+    /**
+     * Reconocer todas las placas de un frame
+     * 
+     * Con reconocedor, las placas que no están en cache van en un solo lote;
+     * con Tesseract, cada una pasa por recognizeMultipleAttempts().
+     * 
+     * @param plates Recortes de placa
+     * @param use_cache Si usar cache de resultados (default: true)
+     * @return Un resultado por recorte, en el mismo orden
+     */
+    std::vector<OCRResult> recognizeBatch(const std::vector<cv::Mat>& plates, bool use_cache = true);
     
     /**
      * Preprocesar imagen de placa para mejor OCR
@@ -83,6 +137,32 @@ public:
      */
     void clearCache();
     
+    /**
+     * Configurar tamaño y tolerancia del cache (lo vacía)
+     */
+    void setCacheConfig(const OCRCacheConfig& config) {
+        cache_.setConfig(config);
+    }
+    
+    /**
+     * Aciertos, fallos y tasa de aciertos del cache
+     */
+    OCRResultCache::Stats getCacheStats() const {
+        return cache_.getStats();
+    }
+    
+    /**
+     * Número de instancias de Tesseract disponibles
+     */
+    size_t getEngineCount() const { return engines_.size(); }
+    
+    /**
+     * Motor que lee las placas (para logs)
+     */
+    std::string getEngineName() const {
+        return recognizer_ ? recognizer_->name() : std::string("tesseract");
+    }
+    
     /**
      * Configurar umbral de confianza mínimo
      * 
@@ -91,43 +171,198 @@ public:
     void setConfidenceThreshold(float threshold) {
         confidence_threshold_ = threshold;
     }
+    
+    /**
+     * Configurar confianza que detiene los intentos restantes
+     * 
+     * @param target Confianza objetivo (default: 0.9)
+     */
+    void setTargetConfidence(float target) {
+        target_confidence_ = target;
+    }
+    
+    /**
+     * Configurar confianza que basta si el texto tiene formato de placa
+     * 
+     * @param confidence Confianza mínima con formato válido (default: 0.6)
+     */
+    void setValidConfidence(float confidence) {
+        valid_confidence_ = confidence;
+    }
+    
+    /**
+     * Configurar confianza mínima para corregir un carácter por posición
+     * 
+     * Por debajo, la lectura se deja como la dio Tesseract.
+     * 
+     * @param confidence Confianza mínima del carácter sustituido (default: 0.4)
+     */
+    void setLayoutSubstitutionConfidence(float confidence) {
+        layout_substitution_confidence_ = confidence;
+    }
+    
+    /**
+     * Probar las variantes en orden, sin paralelismo ni cancelación
+     * 
+     * @param deterministic true para resultados reproducibles
+     */
+    void setDeterministic(bool deterministic) {
+        deterministic_ = deterministic;
+    }
+    
+    /**
+     * Leer solo las binarizaciones mejor puntuadas por componentes conexos
+     * 
+     * @param top Binarizaciones que pasan a Tesseract (0 = todas, sin puntuar)
+     */
+    void setPreselection(int top) {
+        preselect_top_ = std::max(0, top);
+    }
+    
+    /**
+     * Recortar la placa a la banda de los caracteres antes de Tesseract
+     * 
+     * Quita el marco y la línea de la ciudad; no afecta al reconocedor ni
+     * a la ruta rápida, que reciben la placa completa.
+     * 
+     * @param enabled true para recortar
+     * @param config Parámetros de la banda
+     */
+    void setTextBand(bool enabled, const TextBandConfig& config = TextBandConfig()) {
+        text_band_enabled_ = enabled;
+        text_band_ = TextBandExtractor(config);
+    }
+    
+    /**
+     * Victorias por estrategia e intentos promedio por placa
+     */
+    OCRStrategyStats::Summary getStrategyStats() const {
+        return strategy_stats_.getSummary();
+    }
+    
+    /**
+     * Nombres de las estrategias de binarización (más el preprocesado final)
+     */
+    static const std::vector<std::string>& strategyNames();
 
 private:
     std::string language_;
     std::string data_path_;
     float confidence_threshold_;
+    float target_confidence_;
+    float valid_confidence_;
+    float layout_substitution_confidence_;
+    bool deterministic_;
+    int preselect_top_;
     
-    std::unique_ptr<tesseract::TessBaseAPI> tesseract_api_;
+    OCREnginePool engines_;
+    std::unique_ptr<PlateRecognizer> recognizer_;
+    std::unique_ptr<PlateRecognizer> fast_path_;
+    float fast_accept_confidence_;
     bool initialized_;
     
-    // Cache de resultados OCR
-    std::unordered_map<std::string, OCRResult> ocr_cache_;
-    std::mutex cache_mutex_;
-    size_t max_cache_size_;
+    // Qué binarización gana en esta cámara (orden de prueba adaptativo)
+    static constexpr int THRESHOLD_STRATEGY_COUNT = ThresholdBank::STRATEGY_COUNT;
+    static constexpr int FALLBACK_STRATEGY = ThresholdBank::STRATEGY_COUNT;
+    OCRStrategyStats strategy_stats_;
+    
+    // Preselección por componentes conexos (thread-safe, sin estado)
+    BinarizationScorer scorer_;
+    
+    // Banda de los caracteres principales (thread-safe, sin estado)
+    bool text_band_enabled_;
+    TextBandExtractor text_band_;
+    
+    // Cache de resultados OCR (hash perceptual, tolera recortes casi iguales)
+    OCRResultCache cache_;
     
     /**
-     * Calcular hash simple de imagen para cache
+     * Procesar imagen con Tesseract directamente
      * 
-     * @param image Imagen
-     * @return Hash de la imagen
+     * @param engine Instancia prestada del pool
+     * @param processed_image Imagen preprocesada
+     * @param monitor Monitor de cancelación (opcional)
+     * @return Resultado de OCR (vacío si se canceló)
      */
-    std::string calculateImageHash(const cv::Mat& image);
+    OCRResult recognizeInternal(tesseract::TessBaseAPI& engine,
+                                const cv::Mat& processed_image,
+                                tesseract::ETEXT_DESC* monitor = nullptr);
     
     /**
-     * Procesar imagen con Tesseract directamente
+     * Leer una placa con la ruta rápida
      * 
-     * @param processed_image Imagen preprocesada
-     * @return Resultado de OCR
+     * @param plate_image Imagen de la placa
+     * @param result Lectura aceptada
+     * @return true si la lectura basta y no hace falta el OCR
      */
-    OCRResult recognizeInternal(const cv::Mat& processed_image);
+    bool recognizeFast(const cv::Mat& plate_image, OCRResult& result);
     
     /**
-     * Aplicar múltiples técnicas de binarización
+     * Leer una placa con Tesseract probando varias binarizaciones (sin cache)
      * 
-     * @param gray Imagen en escala de grises
-     * @return Vector de imágenes binarizadas
+     * @param plate_image Imagen de la placa
+     * @return Mejor resultado
+     */
+    OCRResult recognizeWithTesseract(const cv::Mat& plate_image);
+    
+    /**
+     * Probar las binarizaciones en orden con una instancia
+     * 
+     * @param bank Binarizaciones de la placa
+     * @param order Estrategias a probar, en orden
+     * @param attempts Contador de llamadas a Tesseract
+     * @return Mejor resultado
+     */
+    OCRResult recognizeSequential(const ThresholdBank& bank, const std::vector<int>& order, int& attempts);
+    
+    /**
+     * Probar las binarizaciones en paralelo con cancelación cooperativa
+     * 
+     * @param bank Binarizaciones de la placa
+     * @param order Estrategias a probar, en orden de prioridad
+     * @param attempts Contador de llamadas a Tesseract (incluye canceladas)
+     * @return Mejor resultado
+     */
+    OCRResult recognizeParallel(const ThresholdBank& bank, const std::vector<int>& order, int& attempts);
+    
+    /**
+     * Quedarse con las binarizaciones mejor puntuadas
+     * 
+     * @param bank Binarizaciones de la placa
+     * @param order Estrategias candidatas, en orden de prioridad
+     * @return Las preselect_top_ de mayor puntaje (en empate, según order),
+     *         con un solo umbral por nivel: la variante de texto oscuro
+     */
+    std::vector<int> preselectStrategies(const ThresholdBank& bank, const std::vector<int>& order) const;
+    
+    /**
+     * Alternativas y confianza de cada símbolo de la última lectura
+     * (ResultIterator / ChoiceIterator)
+     * 
+     * @param engine Instancia que acaba de reconocer
+     * @return Símbolos alfanuméricos en orden de lectura
+     */
+    static std::vector<SymbolAlternatives> extractSymbols(tesseract::TessBaseAPI& engine);
+    
+    /**
+     * Verificar si el texto tiene formato de placa colombiana
+     */
+    static bool isValidPlate(const OCRResult& result);
+    
+    /**
+     * Comparar resultados: formato válido primero, luego confianza
+     */
+    static bool isBetter(const OCRResult& candidate, const OCRResult& best);
+    
+    /**
+     * Verificar si un resultado permite detener los intentos restantes
+     */
+    bool isGoodEnough(const OCRResult& result) const;
+    
+    /**
+     * Callback de cancelación de Tesseract
      */
-    std::vector<cv::Mat> applyMultipleThresholds(const cv::Mat& gray);
+    static bool isCancelled(void* cancel_flag, int words);
 };
 
 } // namespace jetson_lpr
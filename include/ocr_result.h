@@ -0,0 +1,25 @@
+#ifndef OCR_RESULT_H
+#define OCR_RESULT_H
+
+#include <string>
+#include <vector>
+
+namespace jetson_lpr {
+
+/**
+ * Estructura para resultado de OCR
+ */
+struct OCRResult {
+    std::string text;          // Texto reconocido
+    float confidence;          // Confianza (0.0 - 1.0)
+    int attempts;              // Llamadas a Tesseract usadas (0 = desde cache o ruta rápida)
+    int strategy;              // Binarización que produjo el texto (-1 = ninguna)
+    std::vector<float> char_confidences; // Probabilidad de cada carácter (vacío si el motor no la da)
+    
+    OCRResult() : confidence(0.0f), attempts(0), strategy(-1) {}
+    OCRResult(const std::string& t, float c) : text(t), confidence(c), attempts(0), strategy(-1) {}
+};
+
+} // namespace jetson_lpr
+
+#endif // OCR_RESULT_H
@@ -0,0 +1,217 @@
+#ifndef OCR_RESULT_CACHE_H
+#define OCR_RESULT_CACHE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+#include "ocr_result.h"
+
+namespace jetson_lpr {
+
+/**
+ * Parámetros del cache de OCR
+ */
+struct OCRCacheConfig {
+    size_t max_entries;         // Lecturas guardadas (default: 100)
+    size_t max_bytes;           // Límite de memoria (0 = solo max_entries)
+    double ttl_seconds;         // Vida de una lectura (0 = sin vencimiento, default: 10)
+    int max_distance;           // Bits distintos tolerados entre hashes (0-3, default: 1)
+    int stripes;                // Particiones con lock propio (default: 4)
+
+    OCRCacheConfig()
+        : max_entries(100)
+        , max_bytes(0)
+        , ttl_seconds(10.0)
+        , max_distance(1)
+        , stripes(4)
+    {}
+};
+
+/**
+ * Cache de lecturas de OCR indexado por hash perceptual
+ *
+ * La misma placa en frames consecutivos nunca da recortes idénticos
+ * (la caja se mueve unos píxeles, cambia la escala y el ruido), así que
+ * la clave es un dHash de 64 bits de una miniatura normalizada y la
+ * búsqueda acepta hashes a distancia de Hamming pequeña.
+ *
+ * Para no comparar contra todas las entradas se usa multi-index hashing:
+ * el hash se parte en 4 bandas de 16 bits, cada una con su tabla. Si dos
+ * hashes difieren en 3 bits o menos, al menos una banda coincide exacta,
+ * así que basta revisar los candidatos de las 4 tablas.
+ *
+ * Las entradas se reparten en particiones con su propio lock de
+ * lectura/escritura, según la primera banda del hash: los recortes de la
+ * misma placa caen casi siempre en la misma partición, y una búsqueda que
+ * acierta ahí toma un solo lock compartido (las demás se revisan solo si
+ * falla). El acierto se marca con un bit atómico (CLOCK, aproximación O(1)
+ * de LRU), así que los hilos de OCR no se serializan al consultar; una
+ * inserción actualiza la entrada cercana donde esté, sin duplicarla. La capacidad se reserva al configurar: la memoria
+ * queda acotada por max_entries o max_bytes. Las lecturas vencidas (TTL)
+ * no se devuelven y se reemplazan sin segunda oportunidad.
+ *
+ * Thread-safe, salvo setConfig(), que se llama antes de usar el cache.
+ */
+class OCRResultCache {
+public:
+    /**
+     * Estadísticas del cache
+     */
+    struct Stats {
+        uint64_t hits;          // Búsquedas con resultado
+        uint64_t misses;        // Búsquedas sin resultado
+        uint64_t evictions;     // Entradas vigentes reemplazadas por falta de espacio
+        uint64_t expirations;   // Entradas vencidas reemplazadas
+        size_t entries;         // Entradas actuales
+        size_t capacity;        // Entradas máximas
+        size_t bytes;           // Memoria reservada (aproximada)
+        double hit_rate;        // hits / (hits + misses)
+    };
+
+    explicit OCRResultCache(const OCRCacheConfig& config = OCRCacheConfig());
+
+    /**
+     * Cambiar parámetros (vacía el cache; no concurrente con otras llamadas)
+     */
+    void setConfig(const OCRCacheConfig& config);
+
+    /**
+     * Buscar la lectura vigente más cercana
+     *
+     * @param hash Hash perceptual de la placa
+     * @param result Lectura guardada (si hubo acierto)
+     * @return true si hay una entrada a distancia <= max_distance
+     */
+    bool lookup(uint64_t hash, OCRResult& result);
+
+    /**
+     * Guardar una lectura (reemplaza la entrada cercana si ya existe)
+     *
+     * @param hash Hash perceptual de la placa
+     * @param result Lectura
+     */
+    void insert(uint64_t hash, const OCRResult& result);
+
+    /**
+     * Vaciar el cache (conserva las estadísticas)
+     */
+    void clear();
+
+    /**
+     * Obtener estadísticas
+     */
+    Stats getStats() const;
+
+    /**
+     * dHash de 64 bits de una placa
+     *
+     * La placa (gris o BGR) se reduce a 17x4 con INTER_AREA y cada bit dice
+     * si un píxel es más claro que su vecino izquierdo: 16 gradientes por
+     * fila, más resolución a lo ancho, donde están los caracteres. No
+     * depende del brillo ni del contraste global. La comparación de cada
+     * fila es una sola instrucción SSE2/NEON.
+     *
+     * @param plate Recorte de la placa
+     * @return Hash (0 si la imagen está vacía)
+     */
+    static uint64_t perceptualHash(const cv::Mat& plate);
+
+    /**
+     * Bits distintos entre dos hashes
+     */
+    static int hammingDistance(uint64_t a, uint64_t b);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int BANDS = 4;
+    static constexpr int BAND_BITS = 16;
+
+    struct Slot {
+        bool used = false;
+        uint64_t hash = 0;
+        OCRResult result;
+        Clock::time_point inserted;
+        std::atomic<bool> referenced{false};   // Bit de CLOCK (se marca con lock compartido)
+    };
+
+    struct Stripe {
+        std::shared_mutex mutex;
+        std::vector<Slot> slots;
+        std::vector<uint32_t> free_slots;
+        std::unordered_map<uint16_t, std::vector<uint32_t>> bands[BANDS];
+        size_t hand = 0;                        // Aguja de CLOCK
+        size_t used = 0;
+
+        explicit Stripe(size_t capacity);
+    };
+
+    OCRCacheConfig config_;
+    Clock::duration ttl_;
+    size_t capacity_;
+    std::vector<std::unique_ptr<Stripe>> stripes_;
+
+    std::atomic<uint64_t> hits_;
+    std::atomic<uint64_t> misses_;
+    std::atomic<uint64_t> evictions_;
+    std::atomic<uint64_t> expirations_;
+
+    static uint16_t band(uint64_t hash, int index) {
+        return static_cast<uint16_t>(hash >> (index * BAND_BITS));
+    }
+
+    /**
+     * Partición de un hash: por su primera banda, para que los hashes
+     * cercanos de la misma placa caigan casi siempre en la misma
+     */
+    size_t stripeFor(uint64_t hash) const {
+        return (static_cast<uint32_t>(band(hash, 0)) * 2654435761u >> 16) % stripes_.size();
+    }
+
+    /**
+     * Memoria aproximada por entrada (slot más su lugar en las 4 tablas)
+     */
+    static size_t bytesPerEntry();
+
+    bool isExpired(const Slot& slot, Clock::time_point now) const {
+        return ttl_ > Clock::duration::zero() && now - slot.inserted > ttl_;
+    }
+
+    /**
+     * Slot más cercano dentro del radio en una partición (-1 si no hay);
+     * requiere el lock de la partición
+     *
+     * @param include_expired Considerar también entradas vencidas
+     */
+    int findNearest(const Stripe& stripe, uint64_t hash, Clock::time_point now,
+                    bool include_expired, int& distance) const;
+
+    /**
+     * Slot libre o víctima de CLOCK; requiere el lock exclusivo
+     */
+    uint32_t allocate(Stripe& stripe, Clock::time_point now);
+
+    /**
+     * Escribir e indexar una lectura en un slot desindexado; requiere el lock exclusivo
+     */
+    static void store(Stripe& stripe, uint32_t index, uint64_t hash, const OCRResult& result,
+                      Clock::time_point now);
+
+    /**
+     * Indexar o desindexar un slot en las tablas de bandas
+     */
+    static void indexSlot(Stripe& stripe, uint32_t index);
+    static void unindexSlot(Stripe& stripe, uint32_t index);
+};
+
+} // namespace jetson_lpr
+
+#endif // OCR_RESULT_CACHE_H
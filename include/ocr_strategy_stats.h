@@ -0,0 +1,87 @@
+#ifndef OCR_STRATEGY_STATS_H
+#define OCR_STRATEGY_STATS_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+
+namespace jetson_lpr {
+
+/**
+ * Estadísticas en línea de las estrategias de binarización del OCR
+ *
+ * Cada cámara tiene su iluminación y sus placas típicas, así que la
+ * estrategia que suele ganar varía por cámara y por franja horaria (día,
+ * noche con IR, contraluz). Esta clase lleva una tasa de victorias con
+ * decaimiento exponencial por franja y devuelve las estrategias ordenadas
+ * por esa tasa, para probar primero la que más probablemente acierte.
+ */
+class OCRStrategyStats {
+public:
+    /**
+     * Resumen exportable
+     */
+    struct Summary {
+        std::vector<std::string> names;     // Nombre de cada estrategia
+        std::vector<uint64_t> wins;         // Victorias totales por estrategia
+        uint64_t plates;                    // Placas reconocidas (con ganadora)
+        uint64_t failures;                  // Placas sin resultado
+        double average_attempts;            // Intentos promedio por placa
+    };
+
+    /**
+     * Constructor
+     *
+     * @param names Nombre de cada estrategia, en el orden por defecto
+     * @param decay Peso de la historia en la tasa reciente (0-1, default: 0.98)
+     * @param time_slots Franjas horarias del día (default: 4 de 6 h)
+     */
+    explicit OCRStrategyStats(const std::vector<std::string>& names,
+                              double decay = 0.98,
+                              int time_slots = 4);
+
+    /**
+     * Orden de prueba para la hora actual
+     *
+     * @return Índices de estrategia, la de mayor tasa reciente primero
+     *         (en empate, el orden por defecto)
+     */
+    std::vector<int> order() const;
+
+    /**
+     * Registrar el resultado de una placa
+     *
+     * @param winner Estrategia ganadora (-1 si ninguna dio texto)
+     * @param attempts Llamadas a Tesseract usadas
+     */
+    void record(int winner, int attempts);
+
+    /**
+     * Obtener resumen
+     */
+    Summary getSummary() const;
+
+private:
+    std::vector<std::string> names_;
+    double decay_;
+    int time_slots_;
+
+    // Tasa reciente por franja: scores_[franja][estrategia]
+    std::vector<std::vector<double>> scores_;
+    std::vector<uint64_t> wins_;
+    uint64_t plates_;
+    uint64_t failures_;
+    uint64_t total_attempts_;
+
+    mutable std::mutex mutex_;
+
+    /**
+     * Franja horaria actual (hora local)
+     */
+    int currentSlot() const;
+};
+
+} // namespace jetson_lpr
+
+#endif // OCR_STRATEGY_STATS_H
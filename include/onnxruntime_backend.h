@@ -0,0 +1,46 @@
+#ifndef ONNXRUNTIME_BACKEND_H
+#define ONNXRUNTIME_BACKEND_H
+
+#include "inference_backend.h"
+
+namespace jetson_lpr {
+
+// Forward declaration (pimpl para no exponer headers de ONNX Runtime)
+struct OrtSessionHolder;
+
+/**
+ * Backend de inferencia con ONNX Runtime (solo con USE_ONNXRUNTIME)
+ *
+ * - Optimizaciones de grafo completas, con cache opcional del grafo
+ *   optimizado en disco
+ * - Control de hilos intra/inter-op
+ * - IOBinding: la entrada se enlaza al buffer del blob y las salidas a
+ *   buffers propios; solo se re-enlazan si cambia la forma o el puntero
+ */
+class OnnxRuntimeBackend : public InferenceBackend {
+public:
+    explicit OnnxRuntimeBackend(const InferenceOptions& options);
+    ~OnnxRuntimeBackend() override;
+
+    bool load(const std::string& model_path) override;
+
+    bool infer(const cv::Mat& blob, std::vector<cv::Mat>& outputs) override;
+
+    std::string name() const override { return "ONNX Runtime"; }
+
+private:
+    InferenceOptions options_;
+    std::unique_ptr<OrtSessionHolder> session_;
+
+    /**
+     * Enlazar entrada y salidas para la forma actual del blob
+     *
+     * @param blob Tensor de entrada
+     * @return true si se enlazó correctamente
+     */
+    bool bind(const cv::Mat& blob);
+};
+
+} // namespace jetson_lpr
+
+#endif // ONNXRUNTIME_BACKEND_H
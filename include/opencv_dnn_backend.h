@@ -0,0 +1,38 @@
+#ifndef OPENCV_DNN_BACKEND_H
+#define OPENCV_DNN_BACKEND_H
+
+#include "inference_backend.h"
+
+namespace jetson_lpr {
+
+/**
+ * Backend de inferencia basado en cv::dnn::Net
+ * Soporta ONNX (incluido INT8 QDQ) y OpenVINO IR (.xml/.bin),
+ * con CUDA/CUDA FP16 si OpenCV lo incluye
+ */
+class OpenCVDnnBackend : public InferenceBackend {
+public:
+    explicit OpenCVDnnBackend(const InferenceOptions& options);
+
+    bool load(const std::string& model_path) override;
+
+    bool infer(const cv::Mat& blob, std::vector<cv::Mat>& outputs) override;
+
+    std::string name() const override { return "OpenCV DNN"; }
+
+private:
+    InferenceOptions options_;
+    cv::dnn::Net net_;
+    std::vector<std::string> output_names_;
+
+    /**
+     * Configurar inferencia en CPU
+     *
+     * @param fp16 Usar FP16 si la versión de OpenCV lo soporta
+     */
+    void setCpuTarget(bool fp16);
+};
+
+} // namespace jetson_lpr
+
+#endif // OPENCV_DNN_BACKEND_H
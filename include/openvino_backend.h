@@ -0,0 +1,66 @@
+#ifndef OPENVINO_BACKEND_H
+#define OPENVINO_BACKEND_H
+
+#include "inference_backend.h"
+#include <exception>
+
+namespace jetson_lpr {
+
+// Forward declaration (pimpl para no exponer headers de OpenVINO)
+struct OpenVINOState;
+
+/**
+ * Backend de inferencia nativo de OpenVINO (solo con USE_OPENVINO)
+ *
+ * Compila el modelo (.xml/.bin u .onnx) en modo THROUGHPUT y mantiene un
+ * pool de solicitudes de inferencia. inferAsync() copia el blob a la
+ * solicitud libre y retorna de inmediato, así el preprocesamiento del
+ * siguiente frame se solapa con la inferencia del anterior.
+ */
+class OpenVINOBackend : public InferenceBackend {
+public:
+    explicit OpenVINOBackend(const InferenceOptions& options);
+    ~OpenVINOBackend() override;
+
+    bool load(const std::string& model_path) override;
+
+    bool infer(const cv::Mat& blob, std::vector<cv::Mat>& outputs) override;
+
+    std::string name() const override { return "OpenVINO"; }
+
+    bool supportsAsync() const override { return true; }
+
+    bool inferAsync(const cv::Mat& blob, InferenceCallback callback) override;
+
+    void waitAll() override;
+
+private:
+    InferenceOptions options_;
+    std::unique_ptr<OpenVINOState> state_;
+
+    /**
+     * Tomar una solicitud libre (bloquea si todas están en curso)
+     *
+     * @return Índice de la solicitud
+     */
+    size_t acquireRequest();
+
+    /**
+     * Devolver una solicitud al pool
+     *
+     * @param index Índice de la solicitud
+     */
+    void releaseRequest(size_t index);
+
+    /**
+     * Completar una solicitud asíncrona (se ejecuta en un hilo de OpenVINO)
+     *
+     * @param index Índice de la solicitud
+     * @param error Excepción de la inferencia (nullptr si fue correcta)
+     */
+    void onRequestComplete(size_t index, std::exception_ptr error);
+};
+
+} // namespace jetson_lpr
+
+#endif // OPENVINO_BACKEND_H
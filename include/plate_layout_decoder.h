@@ -0,0 +1,75 @@
+#ifndef PLATE_LAYOUT_DECODER_H
+#define PLATE_LAYOUT_DECODER_H
+
+#include <string>
+#include <vector>
+
+#include "ocr_result.h"
+
+namespace jetson_lpr {
+
+/**
+ * Alternativa de un símbolo leído por el OCR
+ */
+struct SymbolChoice {
+    char character;             // Letra o dígito en mayúscula
+    float confidence;           // Confianza (0.0 - 1.0)
+
+    SymbolChoice(char c, float conf) : character(c), confidence(conf) {}
+};
+
+/**
+ * Alternativas de un símbolo, la primera es la elegida por el OCR
+ */
+using SymbolAlternatives = std::vector<SymbolChoice>;
+
+/**
+ * Decodificación de símbolos con la disposición de las placas colombianas
+ *
+ * El OCR elige cada carácter sin saber en qué posición está, así que un
+ * solo 0 leído como O invalida la placa entera. Aquí cada posición se
+ * llena con la mejor alternativa de su clase: letras en las posiciones
+ * 1-3 y dígitos en 4-6 (ABC123), o C, D y cuatro dígitos (CD1234). Si
+ * ninguna alternativa es de la clase pedida se usa la confusión conocida
+ * de la primera (O -> 0, I -> 1, ...) con la mitad de su confianza.
+ *
+ * Un carácter sustituido (distinto de la primera alternativa) debe tener
+ * al menos la confianza mínima de sustitución; si no, la disposición no
+ * encaja y se conserva la lectura original, que sigue siendo inválida.
+ *
+ * Con más de 6 símbolos (borde o ciudad leídos como caracteres) se
+ * prueban todas las ventanas de 6 seguidos y gana la de mayor confianza.
+ *
+ * Sin estado: thread-safe.
+ */
+class PlateLayoutDecoder {
+public:
+    /**
+     * Decodificar una lectura por símbolos
+     *
+     * @param symbols Alternativas de cada símbolo, en orden de lectura
+     * @param min_substitution Confianza mínima de un carácter sustituido
+     *        (default: 0.4)
+     * @return Placa con la confianza de cada carácter (vacía si ninguna
+     *         disposición encaja)
+     */
+    static OCRResult decode(const std::vector<SymbolAlternatives>& symbols,
+                            float min_substitution = 0.4f);
+
+private:
+    /**
+     * Ajustar una ventana de símbolos a una disposición
+     *
+     * @param layout 'A' = letra, '9' = dígito, otro = carácter literal
+     * @param first Primer símbolo de la ventana
+     * @param min_substitution Confianza mínima de un carácter sustituido
+     * @return Placa con sus confianzas (vacía si algún símbolo no encaja)
+     */
+    static OCRResult fitLayout(const std::string& layout,
+                               const std::vector<SymbolAlternatives>& symbols, size_t first,
+                               float min_substitution);
+};
+
+} // namespace jetson_lpr
+
+#endif // PLATE_LAYOUT_DECODER_H
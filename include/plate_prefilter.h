@@ -0,0 +1,154 @@
+#ifndef PLATE_PREFILTER_H
+#define PLATE_PREFILTER_H
+
+#include <string>
+#include <atomic>
+#include <opencv2/opencv.hpp>
+
+namespace jetson_lpr {
+
+/**
+ * Tipo de placa según el color de fondo (Colombia)
+ */
+enum class PlateType {
+    UNKNOWN,        // Sin clasificar (filtro de color desactivado o ambiguo)
+    PARTICULAR,     // Fondo amarillo
+    PUBLICO,        // Fondo blanco
+    DIPLOMATICO,    // Fondo azul
+    MOTO            // Fondo amarillo, formato casi cuadrado
+};
+
+/**
+ * Motivo por el que se descartó una detección
+ */
+enum class PrefilterReason {
+    ACCEPTED,
+    SIZE,           // Caja demasiado pequeña para leer
+    ASPECT,         // Relación ancho/alto fuera de rango
+    EDGE,           // Caja cortada por el borde del frame
+    COLOR           // El fondo no es amarillo, blanco ni azul
+};
+
+/**
+ * Configuración del prefiltro
+ */
+struct PrefilterConfig {
+    int min_width;              // Ancho mínimo en píxeles del frame
+    int min_height;             // Alto mínimo en píxeles del frame
+    float min_aspect;           // Relación ancho/alto mínima (motos ~1.4)
+    float max_aspect;           // Relación ancho/alto máxima (carro ~2.1 + perspectiva)
+    float moto_max_aspect;      // Por debajo de esta relación se clasifica como moto
+    int edge_margin;            // Distancia mínima al borde del frame (0 = no verificar)
+    bool color_check;           // Verificar color de fondo en HSV
+    float min_color_ratio;      // Fracción mínima de píxeles del color de fondo
+
+    PrefilterConfig()
+        : min_width(30)
+        , min_height(10)
+        , min_aspect(1.1f)
+        , max_aspect(6.0f)
+        , moto_max_aspect(1.8f)
+        , edge_margin(2)
+        , color_check(true)
+        , min_color_ratio(0.25f)
+    {}
+};
+
+/**
+ * Resultado del prefiltro para una detección
+ */
+struct PrefilterResult {
+    bool accepted;
+    PrefilterReason reason;
+    PlateType type;
+    float color_ratio;          // Fracción del color de fondo dominante
+
+    PrefilterResult()
+        : accepted(false)
+        , reason(PrefilterReason::ACCEPTED)
+        , type(PlateType::UNKNOWN)
+        , color_ratio(0.0f)
+    {}
+};
+
+/**
+ * Prefiltro geométrico y de color antes del OCR
+ *
+ * Tesseract es la etapa más costosa del pipeline; este filtro descarta con
+ * pruebas baratas las cajas que no pueden ser una placa legible (muy
+ * pequeñas, con proporción imposible, cortadas por el borde del frame o
+ * sin fondo amarillo/blanco/azul). La prueba de color trabaja sobre una
+ * versión reducida del centro de la caja, y como subproducto clasifica el
+ * tipo de placa. Un recorte gris (cámara en IR) pasa sin tipo.
+ */
+class PlatePrefilter {
+public:
+    /**
+     * Constructor
+     *
+     * @param config Configuración del prefiltro
+     */
+    explicit PlatePrefilter(const PrefilterConfig& config = PrefilterConfig());
+
+    /**
+     * Evaluar una detección
+     *
+     * @param frame Frame BGR donde se hizo la detección
+     * @param bbox Caja de la placa en coordenadas del frame
+     * @return Resultado (aceptada, motivo y tipo de placa)
+     */
+    PrefilterResult evaluate(const cv::Mat& frame, const cv::Rect& bbox);
+
+    /**
+     * Contadores de descarte por motivo
+     */
+    struct Stats {
+        uint64_t accepted;
+        uint64_t rejected_size;
+        uint64_t rejected_aspect;
+        uint64_t rejected_edge;
+        uint64_t rejected_color;
+    };
+
+    /**
+     * Obtener contadores
+     */
+    Stats getStats() const;
+
+    /**
+     * Nombre del tipo de placa (se guarda en la base de datos)
+     *
+     * @return Vacío para UNKNOWN (se guarda como NULL)
+     */
+    static const char* plateTypeName(PlateType type);
+
+private:
+    PrefilterConfig config_;
+
+    std::atomic<uint64_t> accepted_;
+    std::atomic<uint64_t> rejected_size_;
+    std::atomic<uint64_t> rejected_aspect_;
+    std::atomic<uint64_t> rejected_edge_;
+    std::atomic<uint64_t> rejected_color_;
+
+    /**
+     * Clasificar el color de fondo de la placa
+     *
+     * @param plate Recorte BGR de la placa
+     * @param ratio Salida: fracción de píxeles del color dominante
+     * @param grayscale Salida: el recorte casi no tiene saturación (cámara
+     *        en modo IR/nocturno) y no se puede clasificar
+     * @return Tipo según el color (UNKNOWN si ninguno alcanza el mínimo o
+     *         el recorte es gris)
+     */
+    PlateType classifyColor(const cv::Mat& plate, float& ratio, bool& grayscale) const;
+
+    /**
+     * Registrar el resultado en los contadores
+     */
+    PrefilterResult finish(PrefilterResult result);
+};
+
+} // namespace jetson_lpr
+
+#endif // PLATE_PREFILTER_H
@@ -0,0 +1,50 @@
+#ifndef PLATE_RECOGNIZER_H
+#define PLATE_RECOGNIZER_H
+
+#include <string>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+#include "ocr_result.h"
+
+namespace jetson_lpr {
+
+/**
+ * Interfaz de reconocedores de placa alternativos a Tesseract
+ *
+ * OCRProcessor delega en un reconocedor cuando está configurado
+ * ("ocr.engine"); el cache, el umbral de confianza y las estadísticas
+ * siguen en OCRProcessor. Recibe los recortes tal como salen del frame
+ * (color o gris, cualquier tamaño) y puede procesarlos en lote.
+ *
+ * Las implementaciones deben ser thread-safe: varios hilos de OCR las
+ * llaman a la vez.
+ */
+class PlateRecognizer {
+public:
+    virtual ~PlateRecognizer() = default;
+
+    /**
+     * Cargar modelo o recursos
+     *
+     * @return true si quedó listo
+     */
+    virtual bool initialize() = 0;
+
+    /**
+     * Reconocer varias placas
+     *
+     * @param plates Recortes de placa
+     * @return Un resultado por recorte, en el mismo orden (vacío si falló)
+     */
+    virtual std::vector<OCRResult> recognizeBatch(const std::vector<cv::Mat>& plates) = 0;
+
+    /**
+     * Nombre del reconocedor (para logs)
+     */
+    virtual std::string name() const = 0;
+};
+
+} // namespace jetson_lpr
+
+#endif // PLATE_RECOGNIZER_H
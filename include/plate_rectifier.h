@@ -0,0 +1,116 @@
+#ifndef PLATE_RECTIFIER_H
+#define PLATE_RECTIFIER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace jetson_lpr {
+
+/**
+ * Configuración de la rectificación
+ */
+struct RectifierConfig {
+    int lanes;                  // Franjas verticales del frame con geometría propia (default: 4)
+    float margin;               // Margen alrededor de la caja al buscar el borde (default: 0.15)
+    int stable_samples;         // Estimaciones para dar por estable la geometría del carril (default: 8)
+    int refresh_every;          // Con geometría estable, reestimar 1 de cada N placas (default: 20)
+    float smoothing;            // Peso de cada estimación nueva en el promedio (default: 0.2)
+
+    RectifierConfig()
+        : lanes(4)
+        , margin(0.15f)
+        , stable_samples(8)
+        , refresh_every(20)
+        , smoothing(0.2f)
+    {}
+};
+
+/**
+ * Rectificación de perspectiva de la placa antes del OCR
+ *
+ * Las cámaras de portería ven la placa en ángulo: el recorte sale rotado
+ * y con cizalla, y Tesseract en modo de una línea lo lee mal. Se busca el
+ * cuadrilátero de la placa (bordes de Canny, contorno convexo aproximado
+ * a 4 vértices, o el rectángulo rotado mínimo si no hay 4) y se proyecta
+ * con una homografía a un rectángulo frontal.
+ *
+ * La geometría casi no cambia en cada carril de la cámara, así que las
+ * esquinas se guardan por carril (franja vertical del frame) relativas a
+ * la caja del detector y promediadas. Con geometría estable se reutiliza
+ * sin buscar el contorno (1 de cada refresh_every placas la actualiza), y
+ * si el contorno no aparece en un recorte se usa la del carril.
+ *
+ * Thread-safe.
+ */
+class PlateRectifier {
+public:
+    /**
+     * Estadísticas de la rectificación
+     */
+    struct Stats {
+        uint64_t estimated;     // Cuadrilátero estimado en el recorte
+        uint64_t cached;        // Geometría del carril reutilizada
+        uint64_t passthrough;   // Sin geometría: recorte sin rectificar
+    };
+
+    explicit PlateRectifier(const RectifierConfig& config = RectifierConfig());
+
+    /**
+     * Recortar la placa rectificada
+     *
+     * @param frame Frame completo (la homografía puede tomar píxeles fuera de la caja)
+     * @param bbox Caja de la placa en el frame
+     * @return Placa frontal (o el recorte de la caja si no hay geometría)
+     */
+    cv::Mat rectify(const cv::Mat& frame, const cv::Rect& bbox);
+
+    /**
+     * Estimar el cuadrilátero de la placa
+     *
+     * @param frame Frame completo
+     * @param bbox Caja de la placa en el frame
+     * @param quad Esquinas en el frame (sup-izq, sup-der, inf-der, inf-izq)
+     * @return true si se encontró un contorno creíble
+     */
+    bool estimateQuad(const cv::Mat& frame, const cv::Rect& bbox, std::array<cv::Point2f, 4>& quad) const;
+
+    /**
+     * Obtener estadísticas
+     */
+    Stats getStats() const;
+
+private:
+    using Quad = std::array<cv::Point2f, 4>;
+
+    struct Lane {
+        Quad corners;           // Esquinas relativas a la caja (0-1)
+        int samples = 0;
+        int since_refresh = 0;
+    };
+
+    RectifierConfig config_;
+    std::vector<Lane> lanes_;
+    std::mutex mutex_;
+
+    std::atomic<uint64_t> estimated_;
+    std::atomic<uint64_t> cached_;
+    std::atomic<uint64_t> passthrough_;
+
+    /**
+     * Ordenar 4 puntos como sup-izq, sup-der, inf-der, inf-izq
+     */
+    static Quad orderCorners(const std::vector<cv::Point2f>& points);
+
+    /**
+     * Proyectar el cuadrilátero a un rectángulo de sus mismas dimensiones
+     */
+    static cv::Mat warp(const cv::Mat& frame, const Quad& quad);
+};
+
+} // namespace jetson_lpr
+
+#endif // PLATE_RECTIFIER_H
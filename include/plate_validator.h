@@ -56,6 +56,22 @@ public:
      * @return Texto limpio
      */
     static std::string cleanText(const std::string& text);
+    
+    /**
+     * Dígito con el que se suele confundir una letra ('O' -> '0')
+     * 
+     * @param letter Letra mayúscula
+     * @return Dígito, o 0 si la letra no tiene confusión conocida
+     */
+    static char letterAsDigit(char letter);
+    
+    /**
+     * Letra con la que se suele confundir un dígito ('0' -> 'O')
+     * 
+     * @param digit Dígito
+     * @return Letra, o 0 si el dígito no tiene confusión conocida
+     */
+    static char digitAsLetter(char digit);
 
 private:
     // Patrones de placas colombianas
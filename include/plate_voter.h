@@ -0,0 +1,171 @@
+#ifndef PLATE_VOTER_H
+#define PLATE_VOTER_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace jetson_lpr {
+
+/**
+ * Configuración de la votación entre frames
+ */
+struct PlateVoterConfig {
+    int min_reads;                  // Lecturas antes de decidir (default: 2)
+    float consensus;                // Fracción del peso que necesita el ganador en cada posición (default: 0.6)
+    int max_reads;                  // Con estas lecturas decide la mayoría aunque no haya consenso (default: 6)
+    float max_center_shift;         // Desplazamiento del centro entre frames, en anchos de placa (default: 1.0)
+    double track_timeout_seconds;   // Sin ver la placa este tiempo, el vehículo se olvida (default: 2.0)
+    double resolved_ttl_seconds;    // Tras decidir, se vuelve a leer pasado este tiempo (default: 10.0)
+
+    PlateVoterConfig()
+        : min_reads(2)
+        , consensus(0.6f)
+        , max_reads(6)
+        , max_center_shift(1.0f)
+        , track_timeout_seconds(2.0)
+        , resolved_ttl_seconds(10.0)
+    {}
+};
+
+/**
+ * Resultado de sumar una lectura
+ */
+struct VoteDecision {
+    bool emit;                  // Hay consenso: registrar la placa
+    std::string text;           // Placa por consenso
+    float confidence;           // Confianza promedio del ganador en cada posición
+    int reads;                  // Lecturas acumuladas del vehículo
+    cv::Rect box;               // Última caja del vehículo (decisiones al expirar)
+    float detection_confidence; // Mejor confianza del detector (decisiones al expirar)
+    cv::Rect vehicle_box;       // Caja del vehículo de la última lectura (vacía sin cascada)
+    std::string plate_type;     // Tipo de placa de la última lectura (vacío = sin clasificar)
+
+    VoteDecision() : emit(false), confidence(0.0f), reads(0), detection_confidence(0.0f) {}
+};
+
+/**
+ * Votación por carácter entre lecturas sucesivas del mismo vehículo
+ *
+ * Cada lectura del OCR se juzgaba sola: un carácter mal leído en un frame
+ * terminaba en lpr_detections. Aquí las placas de frames consecutivos se
+ * asocian a un vehículo por cercanía del centro y cada lectura suma, en
+ * cada una de las 6 posiciones, la confianza de su carácter. La placa se
+ * emite cuando el carácter ganador de cada posición reúne la fracción
+ * `consensus` del peso (o al llegar a max_reads, si el resultado tiene
+ * formato válido). Desde entonces ese vehículo no vuelve al OCR mientras
+ * siga a la vista.
+ *
+ * Thread-safe.
+ */
+class PlateVoter {
+public:
+    /**
+     * Estadísticas de la votación
+     */
+    struct Stats {
+        uint64_t tracks;        // Vehículos vistos
+        uint64_t reads;         // Lecturas sumadas
+        uint64_t emitted;       // Placas emitidas por consenso
+        uint64_t expired;       // Placas emitidas por mayoría al dejar de ver el vehículo
+        uint64_t skipped;       // Lecturas de OCR evitadas (vehículo ya decidido)
+    };
+
+    explicit PlateVoter(const PlateVoterConfig& config = PlateVoterConfig());
+
+    /**
+     * Asociar las placas de un frame a vehículos
+     *
+     * Cada caja toma el vehículo más cercano libre; las que no tienen uno
+     * crean uno nuevo. Los vehículos que no se ven hace tiempo se olvidan;
+     * si no llegaron a consenso (por ejemplo, vistos en un solo frame
+     * analizado) su placa sale por mayoría, para no perderla.
+     *
+     * @param boxes Cajas de las placas en coordenadas del frame
+     * @param scores Confianza del detector por caja
+     * @param expired Placas de los vehículos olvidados sin decisión
+     * @return Identificador de vehículo por caja
+     */
+    std::vector<int> assign(const std::vector<cv::Rect>& boxes, const std::vector<float>& scores,
+                            std::vector<VoteDecision>& expired);
+
+    /**
+     * Verificar si un vehículo ya tiene placa decidida (no hace falta OCR)
+     *
+     * @param track_id Identificador de assign()
+     * @return true si ya se emitió su placa
+     */
+    bool isResolved(int track_id);
+
+    /**
+     * Sumar una lectura normalizada
+     *
+     * @param track_id Identificador de assign()
+     * @param text Placa normalizada (6 caracteres)
+     * @param char_confidences Confianza de cada carácter (vacío = usar confidence)
+     * @param confidence Confianza de la lectura
+     * @param vehicle_box Caja del vehículo de esta lectura (vacía sin cascada)
+     * @param plate_type Tipo de placa del prefiltro (vacío = sin clasificar)
+     * @return Decisión
+     */
+    VoteDecision vote(int track_id, const std::string& text,
+                      const std::vector<float>& char_confidences, float confidence,
+                      const cv::Rect& vehicle_box = cv::Rect(),
+                      const std::string& plate_type = std::string());
+
+    /**
+     * Obtener estadísticas
+     */
+    Stats getStats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int POSITIONS = 6;
+    static constexpr int SYMBOLS = 36;      // A-Z y 0-9
+
+    struct Track {
+        int id = 0;
+        cv::Rect box;
+        Clock::time_point last_seen;
+        Clock::time_point resolved_at;
+        std::array<std::array<float, SYMBOLS>, POSITIONS> weights{};
+        int reads = 0;
+        bool resolved = false;
+        float detection_confidence = 0.0f;
+        cv::Rect vehicle_box;
+        std::string plate_type;
+    };
+
+    PlateVoterConfig config_;
+    std::vector<Track> tracks_;
+    int next_id_;
+    Stats stats_;
+    mutable std::mutex mutex_;
+
+    Track* find(int track_id);
+
+    /**
+     * Carácter ganador de cada posición
+     *
+     * @param track Vehículo con al menos una lectura
+     * @param min_share Menor fracción del peso de un ganador
+     * @return Decisión con el texto, la confianza, la caja del vehículo y
+     *         el tipo de placa (emit sin marcar)
+     */
+    static VoteDecision majority(const Track& track, float& min_share);
+
+    /**
+     * Índice de un carácter en los pesos (-1 si no es A-Z ni 0-9)
+     */
+    static int symbolIndex(char c);
+    static char symbolChar(int index);
+};
+
+} // namespace jetson_lpr
+
+#endif // PLATE_VOTER_H
@@ -0,0 +1,83 @@
+#ifndef STARTUP_TIMELINE_H
+#define STARTUP_TIMELINE_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <chrono>
+
+namespace jetson_lpr {
+
+/**
+ * Línea de tiempo del arranque
+ *
+ * Registra inicio y duración de cada paso de inicialización (pueden correr
+ * en hilos distintos) relativos al lanzamiento, más eventos puntuales como
+ * la primera decisión. print() muestra los pasos ordenados por inicio, así
+ * se ve qué se solapó y cuál es el camino crítico.
+ */
+class StartupTimeline {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Constructor (el origen es el momento de construcción)
+     */
+    StartupTimeline();
+
+    /**
+     * Medir un paso
+     *
+     * @param name Nombre del paso
+     * @param step Función a ejecutar
+     * @return Lo que retorna `step`
+     */
+    template <typename Step>
+    auto measure(const std::string& name, Step&& step) -> decltype(step()) {
+        Clock::time_point start = Clock::now();
+        struct Finish {
+            StartupTimeline& timeline;
+            const std::string& name;
+            Clock::time_point start;
+            ~Finish() { timeline.record(name, start, Clock::now()); }
+        } finish{*this, name, start};
+        return step();
+    }
+
+    /**
+     * Registrar un paso ya medido
+     */
+    void record(const std::string& name, Clock::time_point start, Clock::time_point end);
+
+    /**
+     * Registrar un evento puntual
+     *
+     * @return Milisegundos desde el lanzamiento
+     */
+    double mark(const std::string& name);
+
+    /**
+     * Milisegundos desde el lanzamiento
+     */
+    double elapsedMs() const;
+
+    /**
+     * Mostrar la línea de tiempo
+     */
+    void print() const;
+
+private:
+    struct Entry {
+        std::string name;
+        double start_ms;
+        double duration_ms;     // 0 para eventos puntuales
+    };
+
+    Clock::time_point origin_;
+    std::vector<Entry> entries_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace jetson_lpr
+
+#endif // STARTUP_TIMELINE_H
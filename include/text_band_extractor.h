@@ -0,0 +1,59 @@
+#ifndef TEXT_BAND_EXTRACTOR_H
+#define TEXT_BAND_EXTRACTOR_H
+
+#include <opencv2/opencv.hpp>
+
+namespace jetson_lpr {
+
+/**
+ * Configuración de la banda de texto
+ */
+struct TextBandConfig {
+    int min_transitions;        // Cambios blanco/negro mínimos en una fila de caracteres (default: 8)
+    float peak_ratio;           // Fracción del máximo de cambios por fila que marca texto (default: 0.35)
+    float min_band_ratio;       // Alto mínimo de la banda respecto al recorte (default: 0.3)
+    float margin;               // Margen arriba y abajo, en altos de banda (default: 0.1)
+
+    TextBandConfig()
+        : min_transitions(8)
+        , peak_ratio(0.35f)
+        , min_band_ratio(0.3f)
+        , margin(0.1f)
+    {}
+};
+
+/**
+ * Banda de los caracteres principales de la placa
+ *
+ * Las placas colombianas llevan el marco y, debajo de los caracteres, el
+ * nombre de la ciudad en letra pequeña. Tesseract en modo de una línea
+ * los mezcla con la placa y hacen falta más binarizaciones para leerla.
+ *
+ * Sobre la placa binarizada (Otsu) se cuentan los cambios blanco/negro
+ * de cada fila: las filas que cruzan los caracteres tienen muchos, las
+ * del marco y del fondo casi ninguno. La banda es el tramo continuo más
+ * alto de filas con cambios (la ciudad forma un tramo más bajo y
+ * separado), con un margen pequeño arriba y abajo.
+ *
+ * Thread-safe: no guarda estado entre llamadas.
+ */
+class TextBandExtractor {
+public:
+    explicit TextBandExtractor(const TextBandConfig& config = TextBandConfig());
+
+    /**
+     * Ubicar la banda de texto
+     *
+     * @param image Placa (BGR o escala de grises)
+     * @return Filas de la banda a todo el ancho (el recorte completo si no
+     *         hay una banda clara)
+     */
+    cv::Rect locate(const cv::Mat& image) const;
+
+private:
+    TextBandConfig config_;
+};
+
+} // namespace jetson_lpr
+
+#endif // TEXT_BAND_EXTRACTOR_H
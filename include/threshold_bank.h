@@ -0,0 +1,117 @@
+#ifndef THRESHOLD_BANK_H
+#define THRESHOLD_BANK_H
+
+#include <vector>
+#include <mutex>
+#include <opencv2/opencv.hpp>
+
+namespace jetson_lpr {
+
+/**
+ * Banco de binarizaciones de una placa
+ *
+ * Calcula de una vez todas las variantes que prueba el OCR: el histograma
+ * y el umbral de Otsu se calculan una sola vez, y Otsu, Otsu inverso y los
+ * umbrales fijos 80/100/120/140 (directo e inverso) se escriben en un único
+ * barrido vectorizado (SSE2/NEON). Los adaptativos (media y gaussiano) son
+ * mucho más caros y se calculan solo la primera vez que se piden con
+ * plane(). Los planos viven en un buffer que solo crece: reutilizar el
+ * banco entre placas no asigna memoria.
+ *
+ * compute() no es thread-safe: cada hilo usa su propio banco. plane() sí
+ * se puede llamar desde varios hilos a la vez. Los planos son válidos
+ * hasta el siguiente compute().
+ */
+class ThresholdBank {
+public:
+    /**
+     * Índices de estrategia (mismo orden que OCRProcessor::strategyNames())
+     */
+    static constexpr int OTSU = 0;
+    static constexpr int OTSU_INV = 1;
+    static constexpr int ADAPTIVE_MEAN = 2;
+    static constexpr int ADAPTIVE_GAUSS = 3;
+    static constexpr int FIRST_FIXED = 4;       // 80, 80 inv, 100, 100 inv, ...
+    static constexpr int STRATEGY_COUNT = 12;
+
+    ThresholdBank();
+
+    /**
+     * Calcular las binarizaciones globales (los adaptativos quedan pendientes)
+     *
+     * @param gray Placa en escala de grises (CV_8UC1)
+     */
+    void compute(const cv::Mat& gray);
+
+    /**
+     * Binarización de una estrategia (vista sobre el buffer interno)
+     *
+     * Un plano adaptativo se calcula aquí la primera vez que se pide.
+     *
+     * @param strategy Índice de estrategia (0 - STRATEGY_COUNT-1)
+     */
+    const cv::Mat& plane(int strategy) const {
+        if (strategy == ADAPTIVE_MEAN || strategy == ADAPTIVE_GAUSS) {
+            computeAdaptive(strategy);
+        }
+        return planes_[strategy];
+    }
+
+    /**
+     * Umbral de Otsu de la última placa
+     */
+    int otsuLevel() const { return otsu_level_; }
+
+    /**
+     * Umbral de una estrategia fija
+     */
+    static int fixedLevel(int strategy) { return 80 + 20 * ((strategy - FIRST_FIXED) / 2); }
+
+    /**
+     * Variante inversa del mismo umbral (Otsu y fijos)
+     *
+     * @return Índice de la inversa (-1 para los adaptativos)
+     */
+    static int inverseOf(int strategy) {
+        return (strategy == ADAPTIVE_MEAN || strategy == ADAPTIVE_GAUSS) ? -1 : strategy ^ 1;
+    }
+
+    /**
+     * Binarizar con una estrategia usando cv::threshold/adaptiveThreshold
+     * (una pasada y una asignación por variante; referencia del benchmark)
+     *
+     * @param gray Imagen en escala de grises
+     * @param strategy Índice de estrategia
+     * @return Imagen binarizada
+     */
+    static cv::Mat applyStrategy(const cv::Mat& gray, int strategy);
+
+private:
+    std::vector<uchar> buffer_;
+    cv::Mat planes_[STRATEGY_COUNT];
+    int otsu_level_;
+
+    // Placa del último compute() y adaptativos ya calculados
+    cv::Mat gray_;
+    mutable std::mutex adaptive_mutex_;
+    mutable bool adaptive_ready_[2];
+
+    /**
+     * Umbral de Otsu a partir del histograma (mismo criterio que OpenCV)
+     */
+    static int otsuFromHistogram(const int* histogram, int total);
+
+    /**
+     * Escribir Otsu y los umbrales fijos en un solo recorrido de la imagen
+     */
+    void sweepGlobal(const cv::Mat& gray);
+
+    /**
+     * Calcular un plano adaptativo si aún no está
+     */
+    void computeAdaptive(int strategy) const;
+};
+
+} // namespace jetson_lpr
+
+#endif // THRESHOLD_BANK_H
@@ -0,0 +1,138 @@
+#ifndef TILED_DETECTOR_H
+#define TILED_DETECTOR_H
+
+#include "detector.h"
+#include "detection_batcher.h"
+#include "nms.h"
+
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace jetson_lpr {
+
+/**
+ * Configuración de detección por teselas
+ * ROI y zonas en coordenadas normalizadas (0.0 - 1.0) del frame original
+ */
+struct TilingConfig {
+    int tile_size;                  // Lado de la tesela en píxeles nativos (= entrada de la red)
+    float overlap;                  // Solapamiento entre teselas vecinas (fracción)
+    cv::Rect2f roi;                 // Región a teselar
+    std::vector<cv::Rect2f> zones;  // Solo teselas que tocan estas zonas (vacío = toda la ROI)
+    int interval;                   // Teselar 1 de cada N frames procesados
+    int max_tiles_per_run;          // Teselas por ejecución, rotando (0 = todas)
+    int batch_size;                 // Teselas por inferencia
+    float merge_iou;                // IoU del NMS entre teselas y frame completo
+
+    TilingConfig()
+        : tile_size(640)
+        , overlap(0.2f)
+        , roi(0.0f, 0.0f, 1.0f, 1.0f)
+        , interval(5)
+        , max_tiles_per_run(0)
+        , batch_size(4)
+        , merge_iou(0.5f)
+    {}
+};
+
+/**
+ * Detección por teselas a resolución nativa para placas lejanas
+ *
+ * Con el frame reducido a processing_resolution una placa a 15+ m mide
+ * pocos píxeles. Esta clase divide la ROI del frame original en teselas
+ * solapadas del tamaño de entrada de la red (sin reescalar), las envía en
+ * lotes al detector y devuelve las cajas en coordenadas del frame original.
+ * merge() combina esas cajas con las del frame completo mediante NMS.
+ *
+ * El costo se acota con el planificador: solo se tesela cada `interval`
+ * frames, solo en las zonas configuradas y, opcionalmente, rotando un
+ * máximo de teselas por ejecución.
+ */
+class TiledDetector {
+public:
+    /**
+     * Constructor
+     *
+     * @param detector Detector compartido
+     * @param config Configuración de teselas
+     * @param batcher Agrupador opcional; si existe, las teselas se envían por él
+     *                (el detector solo se usa desde el hilo del batcher)
+     */
+    TiledDetector(PlateDetector& detector,
+                  const TilingConfig& config,
+                  DetectionBatcher* batcher = nullptr);
+
+    /**
+     * Avanzar el planificador un frame
+     *
+     * @return true si en este frame corresponde teselar
+     */
+    bool shouldRun();
+
+    /**
+     * Detectar placas en las teselas que tocan en esta ejecución
+     *
+     * @param frame Frame a resolución original
+     * @return Detecciones en coordenadas de frame
+     */
+    std::vector<PlateDetection> detect(const cv::Mat& frame);
+
+    /**
+     * Combinar detecciones del frame completo con las de teselas (NMS)
+     *
+     * @param full_frame Detecciones del frame completo (coordenadas originales,
+     *                   ver mapDetectionsToFrame)
+     * @param tiled Detecciones de teselas (coordenadas originales)
+     * @return Detecciones combinadas en coordenadas originales
+     */
+    std::vector<PlateDetection> merge(const std::vector<PlateDetection>& full_frame,
+                                      const std::vector<PlateDetection>& tiled);
+
+    /**
+     * Obtener teselas para un tamaño de frame (coordenadas originales)
+     */
+    const std::vector<cv::Rect>& getTiles(const cv::Size& frame_size);
+
+    /**
+     * Promedio de teselas procesadas por frame (todos los frames, no solo los teselados)
+     */
+    double getAverageTilesPerFrame() const;
+
+private:
+    PlateDetector& detector_;
+    TilingConfig config_;
+    DetectionBatcher* batcher_;
+
+    // Cuadrícula (se recalcula solo si cambia el tamaño del frame)
+    cv::Size grid_frame_size_;
+    std::vector<cv::Rect> tiles_;
+    cv::Rect roi_px_;
+    int overlap_px_;
+
+    // Planificador
+    uint64_t frame_count_;
+    uint64_t tiles_processed_;
+    size_t next_tile_;
+
+    // Buffers del NMS de combinación
+    CandidateBuffer candidates_;
+    FastNMS nms_;
+
+    /**
+     * Construir la cuadrícula de teselas para un tamaño de frame
+     */
+    void buildTiles(const cv::Size& frame_size);
+
+    /**
+     * Verificar si una detección está cortada por un borde interior de la tesela
+     * (la tesela vecina la contiene completa gracias al solapamiento)
+     *
+     * @param bbox Caja en coordenadas de la tesela
+     * @param tile Tesela en coordenadas de frame
+     */
+    bool isCutByInnerEdge(const cv::Rect& bbox, const cv::Rect& tile) const;
+};
+
+} // namespace jetson_lpr
+
+#endif // TILED_DETECTOR_H
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""
+Script para cuantizar el detector ONNX a INT8 (formato QDQ)
+Usa los tensores generados por tools/calibrate_detector (mismo preprocesamiento que en C++)
+"""
+
+import sys
+import os
+import argparse
+from pathlib import Path
+
+
+def load_manifest(manifest_path):
+    """
+    Leer el manifiesto de calibración
+
+    Args:
+        manifest_path: Ruta a calibration.txt
+
+    Returns:
+        Lista de rutas .npy
+    """
+    manifest_path = Path(manifest_path)
+    base_dir = manifest_path.parent
+    with open(manifest_path) as f:
+        return [base_dir / line.strip() for line in f if line.strip()]
+
+
+def quantize_detector(model_path, manifest_path, output_path=None, method="minmax", per_channel=True):
+    """
+    Cuantizar modelo ONNX a INT8 con calibración estática
+
+    Args:
+        model_path: Ruta al modelo FP32 .onnx
+        manifest_path: Manifiesto generado por calibrate_detector
+        output_path: Ruta de salida (opcional, por defecto <modelo>_int8.onnx)
+        method: Método de calibración ("minmax", "entropy" o "percentile")
+        per_channel: Cuantizar pesos por canal (mejor precisión en convoluciones)
+    """
+    try:
+        import numpy as np
+        from onnxruntime.quantization import (
+            CalibrationDataReader, CalibrationMethod, QuantFormat, QuantType, quantize_static
+        )
+        from onnxruntime.quantization.shape_inference import quant_pre_process
+    except ImportError:
+        print("❌ Error: onnxruntime no está instalado")
+        print("Instala con: pip install onnxruntime numpy")
+        return False
+
+    model_path = Path(model_path)
+    if not model_path.exists():
+        print(f"❌ Error: Modelo no encontrado: {model_path}")
+        return False
+
+    samples = load_manifest(manifest_path)
+    if not samples:
+        print(f"❌ Error: Manifiesto vacío: {manifest_path}")
+        return False
+
+    if output_path is None:
+        output_path = model_path.parent / f"{model_path.stem}_int8.onnx"
+    output_path = Path(output_path)
+
+    import onnx
+    input_name = onnx.load(str(model_path)).graph.input[0].name
+
+    class DetectorDataReader(CalibrationDataReader):
+        def __init__(self):
+            self._iter = iter(samples)
+
+        def get_next(self):
+            path = next(self._iter, None)
+            if path is None:
+                return None
+            return {input_name: np.load(path)}
+
+    methods = {
+        "minmax": CalibrationMethod.MinMax,
+        "entropy": CalibrationMethod.Entropy,
+        "percentile": CalibrationMethod.Percentile,
+    }
+
+    print(f"🔄 Cuantizando modelo a INT8 (QDQ)...")
+    print(f"   Entrada: {model_path}")
+    print(f"   Salida: {output_path}")
+    print(f"   Muestras de calibración: {len(samples)} ({method})")
+
+    # Inferencia de formas + fusiones previas: mejora la ubicación de los nodos Q/DQ
+    preprocessed_path = output_path.parent / f"{model_path.stem}_prep.onnx"
+    quant_pre_process(str(model_path), str(preprocessed_path))
+
+    try:
+        quantize_static(
+            str(preprocessed_path),
+            str(output_path),
+            DetectorDataReader(),
+            quant_format=QuantFormat.QDQ,       # Soportado por ORT, OpenVINO y OpenCV DNN
+            activation_type=QuantType.QUInt8,
+            weight_type=QuantType.QInt8,
+            per_channel=per_channel,
+            calibrate_method=methods[method],
+        )
+    finally:
+        os.remove(preprocessed_path)
+
+    size_fp32 = model_path.stat().st_size / 1024 / 1024
+    size_int8 = output_path.stat().st_size / 1024 / 1024
+    print(f"✅ Modelo INT8 generado: {output_path} ({size_fp32:.1f} MB -> {size_int8:.1f} MB)")
+    print("💡 Compare precisión y latencia con: lpr_benchmark detector --fp32 <modelo> --int8 <modelo_int8> --frames <dir>")
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Cuantizar detector ONNX a INT8 (QDQ)")
+    parser.add_argument("model", help="Modelo FP32 .onnx")
+    parser.add_argument("manifest", help="calibration.txt generado por calibrate_detector")
+    parser.add_argument("-o", "--output", help="Modelo de salida (default: <modelo>_int8.onnx)")
+    parser.add_argument("--method", choices=["minmax", "entropy", "percentile"], default="minmax",
+                        help="Método de calibración (default: minmax)")
+    parser.add_argument("--per-tensor", action="store_true",
+                        help="Cuantizar pesos por tensor en lugar de por canal")
+    args = parser.parse_args()
+
+    ok = quantize_detector(args.model, args.manifest, args.output, args.method, not args.per_tensor)
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -122,6 +122,7 @@ CREATE TABLE IF NOT EXISTS lpr_detections (
     vehicle_bbox TEXT,
     plate_bbox TEXT,
     camera_location VARCHAR(100) DEFAULT 'entrada_principal',
+    plate_type VARCHAR(20) DEFAULT NULL,
     processed BOOLEAN DEFAULT FALSE,
     entry_type ENUM('entrada', 'salida') DEFAULT 'entrada',
     
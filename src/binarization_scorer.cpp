@@ -0,0 +1,173 @@
+#include "binarization_scorer.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace jetson_lpr {
+
+BinarizationScorer::BinarizationScorer(int expected_characters)
+    : expected_characters_(std::max(1, expected_characters))
+{
+}
+
+BinarizationScore BinarizationScorer::score(const cv::Mat& binary) const {
+    if (binary.empty() || binary.type() != CV_8UC1) {
+        return BinarizationScore();
+    }
+
+    // Placas colombianas: caracteres oscuros sobre fondo claro, pero las
+    // variantes inversas los dejan en blanco
+    cv::Mat inverted;
+    cv::bitwise_not(binary, inverted);
+
+    BinarizationScore dark = scoreForeground(inverted);
+    BinarizationScore light = scoreForeground(binary);
+    return dark.score >= light.score ? dark : light;
+}
+
+BinarizationScore BinarizationScorer::segment(const cv::Mat& binary, std::vector<cv::Rect>& characters,
+                                              bool& dark_text) const {
+    characters.clear();
+    dark_text = true;
+    if (binary.empty() || binary.type() != CV_8UC1) {
+        return BinarizationScore();
+    }
+
+    cv::Mat inverted;
+    cv::bitwise_not(binary, inverted);
+
+    std::vector<cv::Rect> dark_characters;
+    std::vector<cv::Rect> light_characters;
+    BinarizationScore dark = scoreForeground(inverted, &dark_characters);
+    BinarizationScore light = scoreForeground(binary, &light_characters);
+
+    if (dark.score >= light.score) {
+        characters.swap(dark_characters);
+        return dark;
+    }
+    dark_text = false;
+    characters.swap(light_characters);
+    return light;
+}
+
+BinarizationScore BinarizationScorer::scoreForeground(const cv::Mat& foreground,
+                                                      std::vector<cv::Rect>* characters) const {
+    BinarizationScore result;
+
+    cv::Mat labels, stats, centroids;
+    int count = cv::connectedComponentsWithStats(foreground, labels, stats, centroids, 8, CV_32S);
+    if (count <= 1) {
+        return result;
+    }
+
+    const float image_height = static_cast<float>(foreground.rows);
+
+    // Componentes con forma de carácter (la etiqueta 0 es el fondo)
+    std::vector<int> candidates;
+    for (int i = 1; i < count; ++i) {
+        const int width = stats.at<int>(i, cv::CC_STAT_WIDTH);
+        const int height = stats.at<int>(i, cv::CC_STAT_HEIGHT);
+        const int area = stats.at<int>(i, cv::CC_STAT_AREA);
+
+        // Más bajos son la ciudad o ruido; más altos, el marco
+        if (height < 0.3f * image_height || height > 0.95f * image_height) {
+            continue;
+        }
+
+        float aspect = static_cast<float>(width) / height;
+        if (aspect < 0.1f || aspect > 1.0f) {
+            continue;
+        }
+
+        // Un carácter ni es un bloque sólido ni un contorno disperso
+        float fill = static_cast<float>(area) / (width * height);
+        if (fill < 0.15f || fill > 0.9f) {
+            continue;
+        }
+
+        candidates.push_back(i);
+    }
+
+    result.components = static_cast<int>(candidates.size());
+    if (candidates.empty()) {
+        return result;
+    }
+
+    // Fila más larga: centros a la misma altura y alturas parecidas
+    std::vector<int> row;
+    for (int anchor : candidates) {
+        const float anchor_y = static_cast<float>(centroids.at<double>(anchor, 1));
+        const float anchor_h = static_cast<float>(stats.at<int>(anchor, cv::CC_STAT_HEIGHT));
+
+        std::vector<int> group;
+        for (int other : candidates) {
+            const float y = static_cast<float>(centroids.at<double>(other, 1));
+            const float h = static_cast<float>(stats.at<int>(other, cv::CC_STAT_HEIGHT));
+            if (std::abs(y - anchor_y) <= 0.2f * anchor_h && std::abs(h - anchor_h) <= 0.25f * anchor_h) {
+                group.push_back(other);
+            }
+        }
+
+        if (group.size() > row.size()) {
+            row.swap(group);
+        }
+    }
+    result.aligned = static_cast<int>(row.size());
+
+    if (characters) {
+        for (int label : row) {
+            characters->emplace_back(stats.at<int>(label, cv::CC_STAT_LEFT),
+                                     stats.at<int>(label, cv::CC_STAT_TOP),
+                                     stats.at<int>(label, cv::CC_STAT_WIDTH),
+                                     stats.at<int>(label, cv::CC_STAT_HEIGHT));
+        }
+        std::sort(characters->begin(), characters->end(),
+                  [](const cv::Rect& a, const cv::Rect& b) { return a.x < b.x; });
+    }
+
+    // Grosor de trazo: longitud de los tramos horizontales de cada carácter
+    if (row.size() >= 2) {
+        double sum = 0.0;
+        double sum_sq = 0.0;
+        int runs = 0;
+
+        for (int label : row) {
+            const int left = stats.at<int>(label, cv::CC_STAT_LEFT);
+            const int top = stats.at<int>(label, cv::CC_STAT_TOP);
+            const int right = left + stats.at<int>(label, cv::CC_STAT_WIDTH);
+            const int bottom = top + stats.at<int>(label, cv::CC_STAT_HEIGHT);
+
+            for (int y = top; y < bottom; ++y) {
+                const int* label_row = labels.ptr<int>(y);
+                int run = 0;
+                for (int x = left; x <= right; ++x) {
+                    if (x < right && label_row[x] == label) {
+                        run++;
+                    } else if (run > 0) {
+                        sum += run;
+                        sum_sq += static_cast<double>(run) * run;
+                        runs++;
+                        run = 0;
+                    }
+                }
+            }
+        }
+
+        if (runs > 0) {
+            double mean = sum / runs;
+            double variance = std::max(0.0, sum_sq / runs - mean * mean);
+            double variation = std::sqrt(variance) / std::max(mean, 1e-6);
+            result.stroke_consistency = static_cast<float>(1.0 / (1.0 + variation));
+        }
+    }
+
+    // Combinar: cuántos caracteres en fila, trazo uniforme y poco ruido alrededor
+    float count_term = std::max(0.0f, 1.0f - std::abs(result.aligned - expected_characters_) /
+                                             static_cast<float>(expected_characters_));
+    float clutter_term = static_cast<float>(result.aligned) / (count - 1);
+
+    result.score = 0.55f * count_term + 0.3f * result.stroke_consistency + 0.15f * clutter_term;
+    return result;
+}
+
+} // namespace jetson_lpr
@@ -129,6 +129,10 @@ void* ConfigManager::getNestedValue(const std::string& key) const {
     while (std::getline(iss, segment, '.')) {
         if (current->is_object() && current->contains(segment)) {
             current = &((*current)[segment]);
+        } else if (current->is_array() && !segment.empty() &&
+                   segment.find_first_not_of("0123456789") == std::string::npos &&
+                   std::stoul(segment) < current->size()) {
+            current = &((*current)[std::stoul(segment)]);
         } else {
             return nullptr;
         }
@@ -189,6 +193,27 @@ bool ConfigManager::getBool(const std::string& key, bool default_value) const {
     }
 }
 
+std::vector<double> ConfigManager::getDoubleArray(const std::string& key) const {
+    nlohmann::json* json_ptr = static_cast<nlohmann::json*>(getNestedValue(key));
+    if (!json_ptr || !json_ptr->is_array()) {
+        return {};
+    }
+    
+    try {
+        return json_ptr->get<std::vector<double>>();
+    } catch (const std::exception&) {
+        return {};
+    }
+}
+
+size_t ConfigManager::getArraySize(const std::string& key) const {
+    nlohmann::json* json_ptr = static_cast<nlohmann::json*>(getNestedValue(key));
+    if (!json_ptr || !json_ptr->is_array()) {
+        return 0;
+    }
+    return json_ptr->size();
+}
+
 bool ConfigManager::has(const std::string& key) const {
     return getNestedValue(key) != nullptr;
 }
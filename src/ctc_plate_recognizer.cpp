@@ -0,0 +1,410 @@
+#include "ctc_plate_recognizer.h"
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <map>
+
+namespace jetson_lpr {
+
+CTCPlateRecognizer::CTCPlateRecognizer(const CTCRecognizerConfig& config)
+    : config_(config)
+    , num_classes_(static_cast<int>(config.alphabet.size()) + 1)
+    , blank_(config.blank_index < 0 ? static_cast<int>(config.alphabet.size()) : config.blank_index)
+    , initialized_(false)
+    , batch_supported_(true)
+{
+    config_.max_batch = std::max(1, config_.max_batch);
+    config_.beam_width = std::max(1, config_.beam_width);
+    blank_ = std::min(blank_, num_classes_ - 1);
+}
+
+bool CTCPlateRecognizer::initialize() {
+    if (initialized_) {
+        return true;
+    }
+
+    if (config_.alphabet.empty()) {
+        std::cerr << "Error: el reconocedor CTC necesita un alfabeto" << std::endl;
+        return false;
+    }
+
+    std::ifstream model_file(config_.model_path);
+    if (!model_file.good()) {
+        std::cerr << "Error: no existe el modelo de reconocimiento: " << config_.model_path << std::endl;
+        return false;
+    }
+
+    backend_ = createInferenceBackend(config_.inference);
+    if (!backend_->load(config_.model_path)) {
+        std::cerr << "Error: no se pudo cargar el modelo de reconocimiento: " << config_.model_path << std::endl;
+        return false;
+    }
+
+    // Calentamiento y verificación de la forma de salida
+    initialized_ = true;
+    std::vector<cv::Mat> warmup = {
+        cv::Mat(config_.input_height, config_.input_width, CV_8UC3, cv::Scalar(200, 200, 200))
+    };
+    std::vector<OCRResult> results(1);
+    if (!inferChunk(warmup, 0, 1, results)) {
+        std::cerr << "Error: la salida del modelo no es una secuencia de " << num_classes_
+                  << " clases (alfabeto + blank)" << std::endl;
+        initialized_ = false;
+        return false;
+    }
+
+    // Muchos CRNN/LPRNet se exportan con batch fijo de 1: probar el lote
+    // completo ahora y, si no pasa, leer las placas de una en una
+    if (config_.max_batch > 1) {
+        std::vector<cv::Mat> batch(config_.max_batch, warmup.front());
+        std::vector<OCRResult> batch_results(batch.size());
+        if (!inferChunk(batch, 0, batch.size(), batch_results)) {
+            std::cerr << "⚠️ El modelo de reconocimiento no admite lotes de " << config_.max_batch
+                      << ", leyendo las placas de una en una" << std::endl;
+            batch_supported_ = false;
+        }
+    }
+
+    std::cout << "✅ Reconocedor CTC listo: " << config_.model_path << " ("
+              << config_.input_width << "x" << config_.input_height << ", "
+              << num_classes_ << " clases, " << backend_->name() << ", "
+              << (config_.beam_width > 1 ? "beam " + std::to_string(config_.beam_width) : std::string("greedy"))
+              << ")" << std::endl;
+    return true;
+}
+
+std::string CTCPlateRecognizer::name() const {
+    return "CTC (" + config_.model_path + ")";
+}
+
+std::vector<OCRResult> CTCPlateRecognizer::recognizeBatch(const std::vector<cv::Mat>& plates) {
+    std::vector<OCRResult> results(plates.size());
+    if (!initialized_) {
+        return results;
+    }
+
+    size_t chunk = batch_supported_ ? static_cast<size_t>(config_.max_batch) : 1;
+    for (size_t begin = 0, end = 0; begin < plates.size(); begin = end) {
+        end = std::min(plates.size(), begin + chunk);
+        if (inferChunk(plates, begin, end, results) || end - begin == 1) {
+            continue;
+        }
+
+        // Falló un lote que el calentamiento aceptó (otra forma de entrada):
+        // avisar una vez y seguir placa por placa
+        if (batch_supported_.exchange(false)) {
+            std::cerr << "⚠️ El modelo de reconocimiento rechazó un lote de " << end - begin
+                      << " placas, leyendo de una en una" << std::endl;
+        }
+        chunk = 1;
+        for (size_t i = begin; i < end; ++i) {
+            inferChunk(plates, i, i + 1, results);
+        }
+    }
+    return results;
+}
+
+bool CTCPlateRecognizer::inferChunk(const std::vector<cv::Mat>& plates, size_t begin, size_t end,
+                                    std::vector<OCRResult>& results) {
+    // Mismo número de canales que espera el modelo
+    std::vector<cv::Mat> images;
+    std::vector<size_t> indices;
+    for (size_t i = begin; i < end; ++i) {
+        const cv::Mat& plate = plates[i];
+        if (plate.empty()) {
+            continue;
+        }
+
+        cv::Mat image;
+        if (config_.channels == 1) {
+            if (plate.channels() == 3) {
+                cv::cvtColor(plate, image, cv::COLOR_BGR2GRAY);
+            } else if (plate.channels() == 4) {
+                cv::cvtColor(plate, image, cv::COLOR_BGRA2GRAY);
+            } else {
+                image = plate;
+            }
+        } else {
+            if (plate.channels() == 1) {
+                cv::cvtColor(plate, image, cv::COLOR_GRAY2BGR);
+            } else if (plate.channels() == 4) {
+                cv::cvtColor(plate, image, cv::COLOR_BGRA2BGR);
+            } else {
+                image = plate;
+            }
+        }
+        images.push_back(image);
+        indices.push_back(i);
+    }
+
+    if (images.empty()) {
+        return true;
+    }
+
+    // blob = (imagen - mean) * scale, redimensionada al tamaño fijo
+    cv::Mat blob;
+    cv::dnn::blobFromImages(images, blob, config_.scale,
+                            cv::Size(config_.input_width, config_.input_height),
+                            cv::Scalar(config_.mean, config_.mean, config_.mean),
+                            config_.swap_rb, false, CV_32F);
+
+    const int batch = static_cast<int>(images.size());
+    std::vector<cv::Mat> sequences(batch);
+    {
+        // Las salidas apuntan a buffers del backend: copiar antes de soltar el lock
+        std::lock_guard<std::mutex> lock(backend_mutex_);
+        std::vector<cv::Mat> outputs;
+        if (!backend_->infer(blob, outputs) || outputs.empty()) {
+            return false;
+        }
+        for (int b = 0; b < batch; ++b) {
+            if (!sequenceFor(outputs[0], batch, b, sequences[b])) {
+                return false;
+            }
+        }
+    }
+
+    for (int b = 0; b < batch; ++b) {
+        toProbabilities(sequences[b]);
+        results[indices[b]] = decode(sequences[b]);
+    }
+    return true;
+}
+
+bool CTCPlateRecognizer::sequenceFor(const cv::Mat& output, int batch, int plate, cv::Mat& sequence) const {
+    // Forma sin ejes unitarios intermedios ([N, C, 1, T] -> [N, C, T])
+    std::vector<int> shape;
+    for (int i = 0; i < output.dims; ++i) {
+        if (output.size[i] != 1 || i == 0) {
+            shape.push_back(output.size[i]);
+        }
+    }
+    if (shape.size() == 2 && batch == 1) {
+        shape.insert(shape.begin(), 1);
+    }
+    if (shape.size() != 3 || output.type() != CV_32F) {
+        return false;
+    }
+
+    std::string layout = config_.output_layout;
+    if (layout == "auto") {
+        if (shape[2] == num_classes_ && shape[0] == batch) {
+            layout = "NTC";
+        } else if (shape[2] == num_classes_ && shape[1] == batch) {
+            layout = "TNC";
+        } else if (shape[1] == num_classes_ && shape[0] == batch) {
+            layout = "NCT";
+        } else {
+            return false;
+        }
+    }
+
+    const float* data = reinterpret_cast<const float*>(output.data);
+    if (layout == "NTC") {
+        const int steps = shape[1];
+        if (shape[0] != batch || shape[2] != num_classes_) {
+            return false;
+        }
+        cv::Mat(steps, num_classes_, CV_32F,
+                const_cast<float*>(data + static_cast<size_t>(plate) * steps * num_classes_)).copyTo(sequence);
+    } else if (layout == "TNC") {
+        const int steps = shape[0];
+        if (shape[1] != batch || shape[2] != num_classes_) {
+            return false;
+        }
+        sequence.create(steps, num_classes_, CV_32F);
+        for (int t = 0; t < steps; ++t) {
+            const float* row = data + (static_cast<size_t>(t) * batch + plate) * num_classes_;
+            std::copy(row, row + num_classes_, sequence.ptr<float>(t));
+        }
+    } else if (layout == "NCT") {
+        const int steps = shape[2];
+        if (shape[0] != batch || shape[1] != num_classes_) {
+            return false;
+        }
+        cv::Mat classes_by_step(num_classes_, steps, CV_32F,
+                                const_cast<float*>(data + static_cast<size_t>(plate) * num_classes_ * steps));
+        cv::transpose(classes_by_step, sequence);
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+void CTCPlateRecognizer::toProbabilities(cv::Mat& sequence) {
+    // Sumas por fila: si ya son probabilidades (softmax en el modelo) no tocar
+    cv::Mat sums;
+    cv::reduce(sequence, sums, 1, cv::REDUCE_SUM);
+    double min_value = 0.0;
+    double min_sum = 0.0;
+    double max_sum = 0.0;
+    cv::minMaxLoc(sequence, &min_value);
+    cv::minMaxLoc(sums, &min_sum, &max_sum);
+    if (min_value >= 0.0 && min_sum > 0.999 && max_sum < 1.001) {
+        return;
+    }
+
+    // Softmax estable por fila (logits o log-probabilidades); cada operación
+    // es un kernel vectorizado de OpenCV sobre la fila completa
+    cv::Mat maxima;
+    cv::reduce(sequence, maxima, 1, cv::REDUCE_MAX);
+    for (int t = 0; t < sequence.rows; ++t) {
+        cv::Mat row = sequence.row(t);
+        cv::subtract(row, cv::Scalar(maxima.at<float>(t)), row);
+    }
+    cv::exp(sequence, sequence);
+    cv::reduce(sequence, sums, 1, cv::REDUCE_SUM);
+    for (int t = 0; t < sequence.rows; ++t) {
+        cv::Mat row = sequence.row(t);
+        row *= 1.0 / std::max(sums.at<float>(t), 1e-12f);
+    }
+}
+
+OCRResult CTCPlateRecognizer::decode(const cv::Mat& probabilities) const {
+    OCRResult result = config_.beam_width > 1 ? decodeBeam(probabilities) : decodeGreedy(probabilities);
+
+    // Confianza de la placa: promedio de sus caracteres (como Tesseract con sus palabras)
+    if (!result.char_confidences.empty()) {
+        float sum = 0.0f;
+        for (float confidence : result.char_confidences) {
+            sum += confidence;
+        }
+        result.confidence = sum / result.char_confidences.size();
+    }
+    result.attempts = 1;
+    return result;
+}
+
+OCRResult CTCPlateRecognizer::decodeGreedy(const cv::Mat& probabilities) const {
+    OCRResult result;
+    int previous = blank_;
+
+    for (int t = 0; t < probabilities.rows; ++t) {
+        double best = 0.0;
+        cv::Point best_loc;
+        cv::minMaxLoc(probabilities.row(t), nullptr, &best, nullptr, &best_loc);
+        const int k = best_loc.x;
+
+        if (k != blank_) {
+            if (k != previous) {
+                result.text += classToChar(k);
+                result.char_confidences.push_back(static_cast<float>(best));
+            } else {
+                // Mismo carácter en pasos seguidos: uno solo, con su mejor paso
+                result.char_confidences.back() = std::max(result.char_confidences.back(), static_cast<float>(best));
+            }
+        }
+        previous = k;
+    }
+
+    return result;
+}
+
+OCRResult CTCPlateRecognizer::decodeBeam(const cv::Mat& probabilities) const {
+    // Beam search por prefijos: cada prefijo guarda la probabilidad de
+    // terminar en blank (pb) y en su último carácter (pnb)
+    struct Beam {
+        double pb = 0.0;
+        double pnb = 0.0;
+        std::vector<float> confidences;
+
+        double total() const { return pb + pnb; }
+    };
+
+    // Clases con probabilidad menor no abren prefijos nuevos
+    const float prune = 1e-3f;
+
+    std::map<std::vector<int>, Beam> beams;
+    beams[{}].pb = 1.0;
+
+    for (int t = 0; t < probabilities.rows; ++t) {
+        const float* p = probabilities.ptr<float>(t);
+        std::map<std::vector<int>, Beam> next;
+
+        auto mergeConfidences = [](Beam& target, const std::vector<float>& source) {
+            if (target.confidences.size() < source.size()) {
+                target.confidences.resize(source.size(), 0.0f);
+            }
+            for (size_t i = 0; i < source.size(); ++i) {
+                target.confidences[i] = std::max(target.confidences[i], source[i]);
+            }
+        };
+
+        for (const auto& entry : beams) {
+            const std::vector<int>& prefix = entry.first;
+            const Beam& beam = entry.second;
+            const int last = prefix.empty() ? -1 : prefix.back();
+
+            // Blank: el prefijo no cambia
+            Beam& same = next[prefix];
+            same.pb += beam.total() * p[blank_];
+            mergeConfidences(same, beam.confidences);
+
+            for (int k = 0; k < num_classes_; ++k) {
+                if (k == blank_ || p[k] < prune) {
+                    continue;
+                }
+
+                std::vector<int> extended = prefix;
+                extended.push_back(k);
+                std::vector<float> extended_confidences = beam.confidences;
+                extended_confidences.push_back(p[k]);
+
+                if (k == last) {
+                    // Repetido sin blank en medio: mismo carácter
+                    Beam& repeated = next[prefix];
+                    repeated.pnb += beam.pnb * p[k];
+                    std::vector<float> updated = beam.confidences;
+                    updated.back() = std::max(updated.back(), p[k]);
+                    mergeConfidences(repeated, updated);
+
+                    // Con blank en medio: carácter nuevo
+                    Beam& target = next[extended];
+                    target.pnb += beam.pb * p[k];
+                    mergeConfidences(target, extended_confidences);
+                } else {
+                    Beam& target = next[extended];
+                    target.pnb += beam.total() * p[k];
+                    mergeConfidences(target, extended_confidences);
+                }
+            }
+        }
+
+        // Conservar los beam_width prefijos más probables
+        std::vector<std::pair<double, std::vector<int>>> ranked;
+        ranked.reserve(next.size());
+        for (const auto& entry : next) {
+            ranked.emplace_back(entry.second.total(), entry.first);
+        }
+        size_t keep = std::min(ranked.size(), static_cast<size_t>(config_.beam_width));
+        std::partial_sort(ranked.begin(), ranked.begin() + keep, ranked.end(),
+                          [](const auto& a, const auto& b) { return a.first > b.first; });
+
+        beams.clear();
+        for (size_t i = 0; i < keep; ++i) {
+            beams[ranked[i].second] = std::move(next[ranked[i].second]);
+        }
+    }
+
+    OCRResult result;
+    const Beam* best = nullptr;
+    const std::vector<int>* best_prefix = nullptr;
+    for (const auto& entry : beams) {
+        if (!best || entry.second.total() > best->total()) {
+            best = &entry.second;
+            best_prefix = &entry.first;
+        }
+    }
+
+    if (best) {
+        for (int k : *best_prefix) {
+            result.text += classToChar(k);
+        }
+        result.char_confidences = best->confidences;
+        result.char_confidences.resize(result.text.size(), 0.0f);
+    }
+    return result;
+}
+
+} // namespace jetson_lpr
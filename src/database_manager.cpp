@@ -95,7 +95,7 @@ bool DatabaseManager::insertDetection(const DetectionData& detection) {
         std::ostringstream query;
         query << "INSERT INTO lpr_detections "
               << "(timestamp, plate_text, confidence, plate_score, "
-              << "vehicle_bbox, plate_bbox, camera_location) "
+              << "vehicle_bbox, plate_bbox, camera_location, plate_type) "
               << "VALUES (";
         
         // Timestamp
@@ -129,7 +129,14 @@ bool DatabaseManager::insertDetection(const DetectionData& detection) {
               << "]', ";
         
         // Camera location
-        query << "'" << escapeString(detection.camera_location) << "'";
+        query << "'" << escapeString(detection.camera_location) << "', ";
+        
+        // Plate type (NULL si el prefiltro no lo clasificó)
+        if (detection.plate_type.empty()) {
+            query << "NULL";
+        } else {
+            query << "'" << escapeString(detection.plate_type) << "'";
+        }
         
         query << ")";
         
@@ -195,7 +202,7 @@ std::vector<DetectionData> DatabaseManager::getRecentDetections(int hours) {
     try {
         std::ostringstream query;
         query << "SELECT timestamp, plate_text, confidence, plate_score, "
-              << "vehicle_bbox, plate_bbox, camera_location "
+              << "vehicle_bbox, plate_bbox, camera_location, plate_type "
               << "FROM lpr_detections "
               << "WHERE timestamp >= DATE_SUB(NOW(), INTERVAL " << hours << " HOUR) "
               << "ORDER BY timestamp DESC "
@@ -243,6 +250,7 @@ std::vector<DetectionData> DatabaseManager::getRecentDetections(int hours) {
                     >> detection.plate_bbox[3];
             }
             if (row[6]) detection.camera_location = row[6];
+            if (row[7]) detection.plate_type = row[7];
             
             detections.push_back(detection);
         }
@@ -272,6 +280,7 @@ bool DatabaseManager::createTablesIfNotExist() {
             vehicle_bbox TEXT,
             plate_bbox TEXT,
             camera_location VARCHAR(100) DEFAULT 'entrada_principal',
+            plate_type VARCHAR(20) DEFAULT NULL,
             processed BOOLEAN DEFAULT FALSE,
             entry_type ENUM('entrada', 'salida') DEFAULT 'entrada',
             
@@ -285,6 +294,11 @@ bool DatabaseManager::createTablesIfNotExist() {
         return false;
     }
     
+    // Tablas creadas antes del prefiltro no tienen plate_type
+    if (!ensureColumn("lpr_detections", "plate_type", "VARCHAR(20) DEFAULT NULL AFTER camera_location")) {
+        return false;
+    }
+    
     // Crear tabla de vehículos registrados
     std::string create_vehicles = R"(
         CREATE TABLE IF NOT EXISTS registered_vehicles (
@@ -350,6 +364,37 @@ bool DatabaseManager::executeQuery(const std::string& query) {
     return true;
 }
 
+bool DatabaseManager::ensureColumn(const std::string& table,
+                                   const std::string& column,
+                                   const std::string& definition) {
+    std::ostringstream query;
+    query << "SELECT COUNT(*) FROM information_schema.COLUMNS "
+          << "WHERE TABLE_SCHEMA = DATABASE() "
+          << "AND TABLE_NAME = '" << escapeString(table) << "' "
+          << "AND COLUMN_NAME = '" << escapeString(column) << "'";
+    
+    if (mysql_query(connection_, query.str().c_str()) != 0) {
+        std::cerr << "Error en consulta: " << mysql_error(connection_) << std::endl;
+        return false;
+    }
+    
+    MYSQL_RES* result = mysql_store_result(connection_);
+    if (!result) {
+        return false;
+    }
+    
+    MYSQL_ROW row = mysql_fetch_row(result);
+    bool exists = row && row[0] && std::stoi(row[0]) > 0;
+    mysql_free_result(result);
+    
+    if (exists) {
+        return true;
+    }
+    
+    std::cout << "🔧 Agregando columna " << table << "." << column << std::endl;
+    return executeQuery("ALTER TABLE " + table + " ADD COLUMN " + column + " " + definition);
+}
+
 std::string DatabaseManager::getCurrentTimestamp() const {
     auto now = std::time(nullptr);
     auto tm = *std::localtime(&now);
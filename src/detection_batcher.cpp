@@ -0,0 +1,124 @@
+#include "detection_batcher.h"
+#include <iostream>
+#include <algorithm>
+
+namespace jetson_lpr {
+
+DetectionBatcher::DetectionBatcher(PlateDetector& detector, int max_batch_size, double window_ms)
+    : detector_(detector)
+    , max_batch_size_(static_cast<size_t>(std::max(1, max_batch_size)))
+    , window_(static_cast<int64_t>(std::max(0.0, window_ms) * 1000.0))
+    , running_(false)
+    , batches_dispatched_(0)
+    , frames_dispatched_(0)
+{
+}
+
+DetectionBatcher::~DetectionBatcher() {
+    stop();
+}
+
+void DetectionBatcher::start() {
+    if (running_) {
+        return;
+    }
+
+    running_ = true;
+    worker_ = std::thread(&DetectionBatcher::dispatchWorker, this);
+
+    std::cout << "📦 Batcher de detección iniciado (lote máx: " << max_batch_size_
+              << ", ventana: " << window_.count() / 1000.0 << " ms)" << std::endl;
+}
+
+void DetectionBatcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cv_.notify_all();
+
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+std::future<std::vector<PlateDetection>> DetectionBatcher::submit(const cv::Mat& frame) {
+    Request request;
+    request.frame = frame;
+    request.arrival = std::chrono::steady_clock::now();
+    std::future<std::vector<PlateDetection>> future = request.promise.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_) {
+            pending_.push_back(std::move(request));
+            cv_.notify_one();
+            return future;
+        }
+    }
+
+    // Sin hilo de despacho: detectar directamente
+    request.promise.set_value(detector_.detect(frame));
+    return future;
+}
+
+double DetectionBatcher::getAverageBatchSize() const {
+    uint64_t batches = batches_dispatched_;
+    if (batches == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(frames_dispatched_) / batches;
+}
+
+void DetectionBatcher::dispatchWorker() {
+    std::vector<Request> batch;
+    std::vector<cv::Mat> frames;
+    batch.reserve(max_batch_size_);
+    frames.reserve(max_batch_size_);
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            cv_.wait(lock, [this]() { return !running_ || !pending_.empty(); });
+
+            if (pending_.empty()) {
+                break;  // Detenido y sin pendientes
+            }
+
+            // Esperar a llenar el lote hasta que venza la ventana del primer frame
+            auto deadline = pending_.front().arrival + window_;
+            cv_.wait_until(lock, deadline, [this]() {
+                return !running_ || pending_.size() >= max_batch_size_;
+            });
+
+            size_t count = std::min(pending_.size(), max_batch_size_);
+            for (size_t i = 0; i < count; ++i) {
+                batch.push_back(std::move(pending_.front()));
+                pending_.pop_front();
+            }
+        }
+
+        for (auto& request : batch) {
+            frames.push_back(request.frame);
+        }
+
+        // Una sola inferencia para todo el lote
+        std::vector<std::vector<PlateDetection>> results = detector_.detectBatch(frames);
+
+        for (size_t i = 0; i < batch.size(); ++i) {
+            batch[i].promise.set_value(std::move(results[i]));
+        }
+
+        batches_dispatched_++;
+        frames_dispatched_ += batch.size();
+
+        batch.clear();
+        frames.clear();
+    }
+}
+
+} // namespace jetson_lpr
@@ -0,0 +1,145 @@
+#include "detection_cascade.h"
+#include <algorithm>
+#include <future>
+
+namespace jetson_lpr {
+
+DetectionCascade::DetectionCascade(PlateDetector& vehicle_detector,
+                                   PlateDetector& plate_detector,
+                                   const CascadeConfig& config,
+                                   DetectionBatcher* plate_batcher)
+    : vehicle_detector_(vehicle_detector)
+    , plate_detector_(plate_detector)
+    , config_(config)
+    , plate_batcher_(plate_batcher)
+{
+    config_.max_vehicles = std::max(1, config_.max_vehicles);
+    config_.batch_size = std::max(1, config_.batch_size);
+    config_.crop_margin = std::max(0.0f, config_.crop_margin);
+
+    NMSConfig nms_config;
+    nms_config.iou_threshold = config_.merge_iou;
+    nms_config.top_k = 0;
+    nms_config.max_detections = 0;
+    nms_.setConfig(nms_config);
+}
+
+std::vector<std::vector<PlateDetection>> DetectionCascade::detectPlates(const std::vector<cv::Mat>& crops) {
+    std::vector<std::vector<PlateDetection>> per_crop;
+    per_crop.reserve(crops.size());
+
+    if (plate_batcher_) {
+        std::vector<std::future<std::vector<PlateDetection>>> futures;
+        for (const cv::Mat& crop : crops) {
+            futures.push_back(plate_batcher_->submit(crop));
+        }
+        for (auto& future : futures) {
+            per_crop.push_back(future.get());
+        }
+        return per_crop;
+    }
+
+    for (size_t start = 0; start < crops.size(); start += config_.batch_size) {
+        size_t end = std::min(crops.size(), start + config_.batch_size);
+        std::vector<cv::Mat> batch(crops.begin() + start, crops.begin() + end);
+        for (auto& result : plate_detector_.detectBatch(batch)) {
+            per_crop.push_back(std::move(result));
+        }
+    }
+    return per_crop;
+}
+
+std::vector<CascadeDetection> DetectionCascade::detect(const cv::Mat& frame) {
+    std::vector<CascadeDetection> detections;
+    last_vehicles_.clear();
+
+    if (frame.empty()) {
+        return detections;
+    }
+
+    cv::Rect frame_rect(0, 0, frame.cols, frame.rows);
+    cv::Rect roi = cv::Rect(
+        static_cast<int>(config_.roi.x * frame.cols),
+        static_cast<int>(config_.roi.y * frame.rows),
+        static_cast<int>(config_.roi.width * frame.cols),
+        static_cast<int>(config_.roi.height * frame.rows)
+    ) & frame_rect;
+
+    if (roi.empty()) {
+        return detections;
+    }
+
+    // Etapa 1: vehículos (el detector reduce la ROI a su entrada pequeña)
+    std::vector<PlateDetection> vehicles = vehicle_detector_.detect(frame(roi));
+
+    vehicles.erase(std::remove_if(vehicles.begin(), vehicles.end(), [this](const PlateDetection& v) {
+        return std::min(v.bbox.width, v.bbox.height) < config_.min_vehicle_size;
+    }), vehicles.end());
+
+    // Los más grandes primero (más cercanos a la barrera)
+    std::sort(vehicles.begin(), vehicles.end(), [](const PlateDetection& a, const PlateDetection& b) {
+        return a.bbox.area() > b.bbox.area();
+    });
+    if (static_cast<int>(vehicles.size()) > config_.max_vehicles) {
+        vehicles.resize(config_.max_vehicles);
+    }
+
+    if (vehicles.empty()) {
+        return detections;
+    }
+
+    // Etapa 2: placas en los recortes de vehículos a resolución nativa
+    std::vector<cv::Rect> crop_rects;
+    std::vector<cv::Mat> crops;
+    for (const PlateDetection& vehicle : vehicles) {
+        cv::Rect box = vehicle.bbox + roi.tl();
+        last_vehicles_.push_back(box);
+
+        int margin_x = static_cast<int>(box.width * config_.crop_margin);
+        int margin_y = static_cast<int>(box.height * config_.crop_margin);
+        cv::Rect crop = cv::Rect(box.x - margin_x, box.y - margin_y,
+                                 box.width + 2 * margin_x, box.height + 2 * margin_y) & frame_rect;
+        crop_rects.push_back(crop);
+        crops.push_back(frame(crop));
+    }
+
+    std::vector<std::vector<PlateDetection>> per_crop = detectPlates(crops);
+
+    // Fusionar placas repetidas en recortes solapados (vehículos contiguos)
+    candidates_.clear();
+    candidate_vehicle_.clear();
+    for (size_t v = 0; v < per_crop.size() && v < crop_rects.size(); ++v) {
+        const cv::Point offset = crop_rects[v].tl();
+        for (const PlateDetection& plate : per_crop[v]) {
+            cv::Rect box = plate.bbox + offset;
+            candidates_.push(
+                static_cast<float>(box.x), static_cast<float>(box.y),
+                static_cast<float>(box.br().x), static_cast<float>(box.br().y),
+                plate.confidence, plate.class_id
+            );
+            candidate_vehicle_.push_back(static_cast<int>(v));
+        }
+    }
+
+    if (candidates_.empty()) {
+        return detections;
+    }
+
+    for (int idx : nms_.run(candidates_)) {
+        CascadeDetection detection;
+        detection.plate = PlateDetection(
+            cv::Rect(
+                cv::Point(static_cast<int>(candidates_.x1[idx]), static_cast<int>(candidates_.y1[idx])),
+                cv::Point(static_cast<int>(candidates_.x2[idx]), static_cast<int>(candidates_.y2[idx]))
+            ),
+            candidates_.scores[idx],
+            candidates_.class_ids[idx]
+        );
+        detection.vehicle_bbox = last_vehicles_[candidate_vehicle_[idx]];
+        detections.push_back(detection);
+    }
+
+    return detections;
+}
+
+} // namespace jetson_lpr
@@ -2,18 +2,54 @@
 #include <iostream>
 #include <algorithm>
 #include <numeric>
+#include <chrono>
+#include <cmath>
 
 namespace jetson_lpr {
 
-PlateDetector::PlateDetector(const std::string& model_path, float confidence_threshold)
+std::vector<PlateDetection> mapDetectionsToFrame(const std::vector<PlateDetection>& detections,
+                                                 const cv::Size& from,
+                                                 const cv::Size& to) {
+    if (from == to || from.width <= 0 || from.height <= 0) {
+        return detections;
+    }
+    
+    const double scale_x = static_cast<double>(to.width) / from.width;
+    const double scale_y = static_cast<double>(to.height) / from.height;
+    const cv::Rect frame_rect(0, 0, to.width, to.height);
+    
+    std::vector<PlateDetection> mapped;
+    mapped.reserve(detections.size());
+    for (const PlateDetection& det : detections) {
+        // Bordes de la caja (no centros de píxel): x' = x * escala
+        cv::Rect box(
+            cv::Point(static_cast<int>(std::floor(det.bbox.x * scale_x)),
+                      static_cast<int>(std::floor(det.bbox.y * scale_y))),
+            cv::Point(static_cast<int>(std::ceil(det.bbox.br().x * scale_x)),
+                      static_cast<int>(std::ceil(det.bbox.br().y * scale_y)))
+        );
+        mapped.emplace_back(box & frame_rect, det.confidence, det.class_id);
+    }
+    return mapped;
+}
+
+PlateDetector::PlateDetector(const std::string& model_path, float confidence_threshold,
+                             const InferenceOptions& options)
     : model_path_(model_path)
     , confidence_threshold_(confidence_threshold)
     , initialized_(false)
-    , input_size_(640, 640)  // Tamaño estándar YOLO
+    , batch_supported_(true)
+    , inference_options_(options)
+    , active_input_(0)
     , scale_factor_(1.0 / 255.0)  // Normalización 0-255 -> 0-1
     , mean_(0.0, 0.0, 0.0)   // Sin media (ya está normalizado)
     , swap_rb_(true)         // BGR -> RGB
 {
+    inputs_.emplace_back(cv::Size(640, 640), "");  // Tamaño estándar YOLO
+    
+    // YOLOv8 a 640x640 genera 8400 candidatos; reservar una sola vez
+    candidates_.reserve(8400);
+    nms_.reserve(8400);
 }
 
 PlateDetector::~PlateDetector() {
@@ -26,55 +62,154 @@ bool PlateDetector::initialize() {
     }
     
     try {
-        // Intentar cargar modelo ONNX
-        std::string extension = model_path_.substr(model_path_.find_last_of(".") + 1);
-        
-        if (extension == "onnx") {
-            net_ = cv::dnn::readNetFromONNX(model_path_);
-        } else if (extension == "xml" || extension == "bin") {
-            // OpenVINO format
-            net_ = cv::dnn::readNet(model_path_);
-        } else {
-            std::cerr << "Error: Formato de modelo no soportado: " << extension << std::endl;
-            std::cerr << "Soporta: .onnx, .xml/.bin (OpenVINO)" << std::endl;
+        if (!loadInputs(inputs_, model_path_, false)) {
+            if (inputs_.empty()) {
+                inputs_.emplace_back(cv::Size(640, 640), "");
+            }
             return false;
         }
+        active_input_ = inputs_.size() - 1;
+        batch_supported_ = probeBatch(inputs_[active_input_]);
+        
+        initialized_ = true;
+        std::cout << "✅ Detector inicializado: " << model_path_ 
+                  << " (" << inputs_.front().backend->name() << ", entradas:";
+        for (const DetectorInput& input : inputs_) {
+            std::cout << " " << input.size.width << "x" << input.size.height;
+        }
+        std::cout << ")" << std::endl;
         
-        if (net_.empty()) {
-            std::cerr << "Error: No se pudo cargar el modelo: " << model_path_ << std::endl;
+        return true;
+        
+    } catch (const std::exception& e) {
+        std::cerr << "Error al inicializar detector: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+bool PlateDetector::loadInputs(std::vector<DetectorInput>& inputs, const std::string& model_path, bool strict) {
+    for (DetectorInput& input : inputs) {
+        const std::string& path = input.model_path.empty() ? model_path : input.model_path;
+        
+        // Crear backend según configuración (no requiere recompilar)
+        input.backend = createInferenceBackend(inference_options_);
+        
+        if (!input.backend->load(path)) {
+            std::cerr << "Error: No se pudo cargar el modelo: " << path << std::endl;
+            for (DetectorInput& loaded : inputs) {
+                loaded.backend.reset();
+            }
             return false;
         }
         
-        // Configurar backend preferido
-        // En Jetson, intentar CUDA primero, luego CPU
-        #ifdef USE_CUDA
-        try {
-            net_.setPreferableBackend(cv::dnn::DNN_BACKEND_CUDA);
-            net_.setPreferableTarget(cv::dnn::DNN_TARGET_CUDA);
-            std::cout << "✅ Modelo cargado con backend CUDA" << std::endl;
-        } catch (const cv::Exception&) {
-            std::cout << "⚠️ CUDA no disponible, usando CPU" << std::endl;
-            net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
-            net_.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
-        }
-        #else
-        net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
-        net_.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
-        std::cout << "✅ Modelo cargado con backend CPU" << std::endl;
-        #endif
+        // Inferencia de calentamiento: fija formas y asigna los buffers de este tamaño
+        cv::Mat warmup(input.size, CV_8UC3, cv::Scalar::all(0));
+        cv::dnn::blobFromImage(warmup, input.blob, scale_factor_, input.size, mean_, swap_rb_, false, CV_32F);
+        std::vector<cv::Mat> outputs;
+        bool ok = input.backend->infer(input.blob, outputs);
         
-        initialized_ = true;
-        std::cout << "✅ Detector inicializado: " << model_path_ << std::endl;
+        if (strict && (!ok || outputs.empty() || outputs[0].dims < 3)) {
+            // Reemplazo en caliente: el modelo nuevo debe pasar el calentamiento completo
+            std::cerr << "Error: El modelo " << path << " falló el calentamiento a "
+                      << input.size.width << "x" << input.size.height << std::endl;
+            for (DetectorInput& loaded : inputs) {
+                loaded.backend.reset();
+            }
+            return false;
+        }
         
-        return true;
+        if (!ok && inputs.size() > 1) {
+            std::cerr << "⚠️ El modelo " << path << " no acepta entrada " << input.size.width
+                      << "x" << input.size.height << " (¿exportado con forma fija?)" << std::endl;
+            input.backend.reset();
+        }
+    }
+    
+    // Descartar tamaños que el modelo rechazó
+    inputs.erase(std::remove_if(inputs.begin(), inputs.end(),
+        [](const DetectorInput& input) { return !input.backend; }), inputs.end());
+    if (inputs.empty()) {
+        std::cerr << "Error: Ningún tamaño de entrada es válido para " << model_path << std::endl;
+        return false;
+    }
+    
+    return true;
+}
+
+bool PlateDetector::probeBatch(DetectorInput& input) {
+    try {
+        std::vector<cv::Mat> warmup(2, cv::Mat(input.size, CV_8UC3, cv::Scalar::all(0)));
+        cv::dnn::blobFromImages(warmup, input.batch_blob, scale_factor_, input.size, mean_, swap_rb_, false, CV_32F);
         
-    } catch (const cv::Exception& e) {
-        std::cerr << "Error OpenCV al inicializar detector: " << e.what() << std::endl;
+        std::vector<cv::Mat> outputs;
+        if (input.backend->infer(input.batch_blob, outputs) && !outputs.empty() && outputs[0].size[0] == 2) {
+            return true;
+        }
+    } catch (const cv::Exception&) {
+        // Forma rechazada: el modelo tiene batch fijo
+    }
+    
+    std::cout << "ℹ️  El modelo no admite batch dinámico, los lotes se procesan frame a frame" << std::endl;
+    return false;
+}
+
+bool PlateDetector::reloadModel(const std::string& model_path) {
+    if (!initialized_) {
         return false;
+    }
+    
+    // Mismos tamaños (y modelos por tamaño) que el modelo activo
+    std::vector<DetectorInput> fresh;
+    std::string previous_path;
+    {
+        std::shared_lock<std::shared_mutex> lock(model_mutex_);
+        for (const DetectorInput& input : inputs_) {
+            fresh.emplace_back(input.size, input.model_path);
+        }
+        previous_path = model_path_;
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    // Cargar y calentar en este hilo mientras el modelo actual sigue detectando
+    bool loaded = false;
+    try {
+        loaded = loadInputs(fresh, model_path, true);
     } catch (const std::exception& e) {
-        std::cerr << "Error al inicializar detector: " << e.what() << std::endl;
+        std::cerr << "Error al cargar modelo nuevo: " << e.what() << std::endl;
+    }
+    
+    if (!loaded) {
+        std::cerr << "↩️ Se mantiene el modelo actual: " << previous_path << std::endl;
         return false;
     }
+    
+    // El modelo nuevo puede tener otro batch (fijo o dinámico)
+    bool batch_supported = probeBatch(fresh[std::min(active_input_.load(), fresh.size() - 1)]);
+    
+    // Cambio atómico entre frames: espera a que termine la detección en curso
+    {
+        std::unique_lock<std::shared_mutex> lock(model_mutex_);
+        inputs_.swap(fresh);
+        model_path_ = model_path;
+        batch_supported_ = batch_supported;
+    }
+    
+    // Las inferencias asíncronas en curso usan el modelo anterior: liberarlo al terminar
+    for (DetectorInput& input : fresh) {
+        if (input.backend) {
+            input.backend->waitAll();
+        }
+    }
+    fresh.clear();
+    
+    double elapsed_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+    
+    std::cout << "🔄 Modelo del detector reemplazado: " << previous_path << " -> " << model_path
+              << " (carga + calentamiento: " << static_cast<int>(elapsed_ms) << " ms)" << std::endl;
+    return true;
 }
 
 std::vector<PlateDetection> PlateDetector::detect(const cv::Mat& frame) {
@@ -82,25 +217,29 @@ std::vector<PlateDetection> PlateDetector::detect(const cv::Mat& frame) {
         return {};
     }
     
+    std::shared_lock<std::shared_mutex> lock(model_mutex_);
+    return detectLocked(frame);
+}
+
+std::vector<PlateDetection> PlateDetector::detectLocked(const cv::Mat& frame) {
     try {
-        // Preprocesar frame
-        cv::Mat blob;
-        preprocess(frame, blob);
+        DetectorInput& input = inputs_[active_input_];
+        
+        // Preprocesar frame (el blob del tamaño activo se reutiliza entre frames)
+        cv::dnn::blobFromImage(frame, input.blob, scale_factor_, input.size, mean_, swap_rb_, false, CV_32F);
         
         // Inferencia
-        std::vector<std::string> output_names = net_.getUnconnectedOutLayersNames();
         std::vector<cv::Mat> outputs;
-        
-        net_.setInput(blob);
-        net_.forward(outputs, output_names);
+        if (!input.backend->infer(input.blob, outputs)) {
+            return {};
+        }
         
         // Postprocesar resultados
-        std::vector<PlateDetection> detections = postprocess(outputs, frame.size());
+        std::lock_guard<std::mutex> lock(postprocess_mutex_);
+        postprocess(outputs, frame.size(), input.size);
         
         // Aplicar NMS
-        std::vector<PlateDetection> filtered_detections = applyNMS(detections);
-        
-        return filtered_detections;
+        return applyNMS(frame.size());
         
     } catch (const cv::Exception& e) {
         std::cerr << "Error en detección: " << e.what() << std::endl;
@@ -108,13 +247,55 @@ std::vector<PlateDetection> PlateDetector::detect(const cv::Mat& frame) {
     }
 }
 
+bool PlateDetector::detectAsync(const cv::Mat& frame, DetectionCallback callback) {
+    if (!initialized_ || frame.empty()) {
+        callback({});
+        return false;
+    }
+    
+    std::shared_lock<std::shared_mutex> model_lock(model_mutex_);
+    
+    try {
+        DetectorInput& input = inputs_[active_input_];
+        
+        // Preprocesar en este hilo; el backend copia el blob antes de retornar
+        cv::dnn::blobFromImage(frame, input.blob, scale_factor_, input.size, mean_, swap_rb_, false, CV_32F);
+        
+        cv::Size frame_size = frame.size();
+        cv::Size input_size = input.size;
+        
+        return input.backend->inferAsync(input.blob, [this, frame_size, input_size, callback](bool ok, std::vector<cv::Mat>& outputs) {
+            if (!ok) {
+                callback({});
+                return;
+            }
+            
+            std::vector<PlateDetection> detections;
+            {
+                std::lock_guard<std::mutex> lock(postprocess_mutex_);
+                postprocess(outputs, frame_size, input_size);
+                detections = applyNMS(frame_size);
+            }
+            
+            callback(std::move(detections));
+        });
+        
+    } catch (const cv::Exception& e) {
+        std::cerr << "Error en detección asíncrona: " << e.what() << std::endl;
+        callback({});
+        return false;
+    }
+}
+
 void PlateDetector::preprocess(const cv::Mat& frame, cv::Mat& blob) {
+    std::shared_lock<std::shared_mutex> lock(model_mutex_);
+    
     // Crear blob desde frame
     cv::dnn::blobFromImage(
         frame,
         blob,
         scale_factor_,
-        input_size_,
+        inputs_[active_input_].size,
         mean_,
         swap_rb_,
         false,
@@ -122,11 +303,90 @@ void PlateDetector::preprocess(const cv::Mat& frame, cv::Mat& blob) {
     );
 }
 
-std::vector<PlateDetection> PlateDetector::postprocess(
+std::vector<std::vector<PlateDetection>> PlateDetector::detectBatch(
+    const std::vector<cv::Mat>& frames
+) {
+    std::vector<std::vector<PlateDetection>> results(frames.size());
+    
+    if (!initialized_ || frames.empty()) {
+        return results;
+    }
+    
+    // Índices de los frames válidos (los vacíos quedan sin detecciones)
+    std::vector<size_t> valid_indices;
+    std::vector<cv::Mat> valid_frames;
+    valid_indices.reserve(frames.size());
+    valid_frames.reserve(frames.size());
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (!frames[i].empty()) {
+            valid_indices.push_back(i);
+            valid_frames.push_back(frames[i]);
+        }
+    }
+    
+    if (valid_frames.empty()) {
+        return results;
+    }
+    
+    std::shared_lock<std::shared_mutex> model_lock(model_mutex_);
+    
+    // Batch de 1 o modelo con batch fijo: ruta normal
+    if (valid_frames.size() == 1 || !batch_supported_) {
+        for (size_t k = 0; k < valid_frames.size(); ++k) {
+            results[valid_indices[k]] = detectLocked(valid_frames[k]);
+        }
+        return results;
+    }
+    
+    try {
+        DetectorInput& input = inputs_[active_input_];
+        
+        // Un solo tensor N×3×H×W para todo el batch
+        cv::dnn::blobFromImages(
+            valid_frames,
+            input.batch_blob,
+            scale_factor_,
+            input.size,
+            mean_,
+            swap_rb_,
+            false,
+            CV_32F
+        );
+        
+        std::vector<cv::Mat> outputs;
+        bool ok = input.backend->infer(input.batch_blob, outputs);
+        
+        const int batch_size = (!ok || outputs.empty()) ? 0 : outputs[0].size[0];
+        if (batch_size == static_cast<int>(valid_frames.size())) {
+            // Separar salidas por imagen: decodificar + NMS con los buffers compartidos
+            std::lock_guard<std::mutex> lock(postprocess_mutex_);
+            for (size_t k = 0; k < valid_frames.size(); ++k) {
+                postprocess(outputs, valid_frames[k].size(), input.size, static_cast<int>(k));
+                results[valid_indices[k]] = applyNMS(valid_frames[k].size());
+            }
+            return results;
+        }
+        
+    } catch (const cv::Exception& e) {
+        std::cerr << "Error en detección por lotes: " << e.what() << std::endl;
+    }
+    
+    // El calentamiento aceptó el batch: fallo puntual, solo este lote va uno a uno
+    std::cerr << "⚠️ Falló la detección por lotes, procesando estos frames por separado" << std::endl;
+    
+    for (size_t k = 0; k < valid_frames.size(); ++k) {
+        results[valid_indices[k]] = detectLocked(valid_frames[k]);
+    }
+    return results;
+}
+
+void PlateDetector::postprocess(
     const std::vector<cv::Mat>& outputs,
-    const cv::Size& frame_size
+    const cv::Size& frame_size,
+    const cv::Size& input_size,
+    int batch_index
 ) {
-    std::vector<PlateDetection> detections;
+    candidates_.clear();
     
     // YOLO v5/v8 genera outputs en formato [batch, num_detections, 5+num_classes]
     // Para YOLO v8: [batch, num_boxes, 4+num_classes] donde 4 son las coordenadas
@@ -143,24 +403,19 @@ std::vector<PlateDetection> PlateDetector::postprocess(
         }
         
         // Calcular ratios de escalado
-        float x_scale = static_cast<float>(frame_size.width) / input_size_.width;
-        float y_scale = static_cast<float>(frame_size.height) / input_size_.height;
+        float x_scale = static_cast<float>(frame_size.width) / input_size.width;
+        float y_scale = static_cast<float>(frame_size.height) / input_size.height;
+        
+        if (batch_index >= output.size[0]) {
+            continue;
+        }
+        
+        const float* output_data = output.ptr<float>()
+            + static_cast<size_t>(batch_index) * num_detections * num_features;
         
         // Iterar sobre detecciones
         for (int i = 0; i < num_detections; ++i) {
-            float* data = (float*)output.data + i * num_features;
-            
-            // Obtener coordenadas (YOLO formato: center_x, center_y, width, height)
-            float center_x = data[0];
-            float center_y = data[1];
-            float width = data[2];
-            float height = data[3];
-            
-            // Convertir a coordenadas de bbox (x, y, width, height)
-            float x = (center_x - width / 2.0f) * x_scale;
-            float y = (center_y - height / 2.0f) * y_scale;
-            float w = width * x_scale;
-            float h = height * y_scale;
+            const float* data = output_data + i * num_features;
             
             // Obtener confianza (max score de clases)
             float max_confidence = 0.0f;
@@ -179,55 +434,167 @@ std::vector<PlateDetection> PlateDetector::postprocess(
                 max_confidence = 0.5f;
             }
             
-            // Filtrar por umbral de confianza
-            if (max_confidence >= confidence_threshold_) {
-                // Crear bbox
-                cv::Rect bbox(
-                    static_cast<int>(std::max(0.0f, x)),
-                    static_cast<int>(std::max(0.0f, y)),
-                    static_cast<int>(std::min(w, static_cast<float>(frame_size.width))),
-                    static_cast<int>(std::min(h, static_cast<float>(frame_size.height)))
-                );
-                
-                detections.emplace_back(bbox, max_confidence, class_id);
+            // Filtrar por umbral de confianza (único punto de filtrado)
+            if (max_confidence < confidence_threshold_) {
+                continue;
+            }
+            
+            // Filtrar por clase (ej. solo vehículos en un modelo COCO)
+            if (!class_filter_.empty() &&
+                (class_id >= static_cast<int>(class_filter_.size()) || !class_filter_[class_id])) {
+                continue;
             }
+            
+            // Convertir (center_x, center_y, width, height) a esquinas en coordenadas del frame
+            float half_w = data[2] * 0.5f;
+            float half_h = data[3] * 0.5f;
+            
+            candidates_.push(
+                (data[0] - half_w) * x_scale,
+                (data[1] - half_h) * y_scale,
+                (data[0] + half_w) * x_scale,
+                (data[1] + half_h) * y_scale,
+                max_confidence,
+                class_id
+            );
+        }
+    }
+}
+
+void PlateDetector::setClassFilter(const std::vector<int>& class_ids) {
+    std::lock_guard<std::mutex> lock(postprocess_mutex_);
+    class_filter_.clear();
+    for (int id : class_ids) {
+        if (id < 0) {
+            continue;
+        }
+        if (id >= static_cast<int>(class_filter_.size())) {
+            class_filter_.resize(id + 1, false);
+        }
+        class_filter_[id] = true;
+    }
+}
+
+bool PlateDetector::supportsAsync() const {
+    std::shared_lock<std::shared_mutex> lock(model_mutex_);
+    return initialized_ && inputs_.front().backend->supportsAsync();
+}
+
+std::string PlateDetector::getBackendName() const {
+    std::shared_lock<std::shared_mutex> lock(model_mutex_);
+    return initialized_ ? inputs_.front().backend->name() : "";
+}
+
+std::string PlateDetector::getModelPath() const {
+    std::shared_lock<std::shared_mutex> lock(model_mutex_);
+    return model_path_;
+}
+
+cv::Size PlateDetector::getInputSize() const {
+    std::shared_lock<std::shared_mutex> lock(model_mutex_);
+    return inputs_[active_input_].size;
+}
+
+void PlateDetector::waitForPending() {
+    std::shared_lock<std::shared_mutex> lock(model_mutex_);
+    for (DetectorInput& input : inputs_) {
+        if (input.backend) {
+            input.backend->waitAll();
+        }
+    }
+}
+
+void PlateDetector::addInputSize(const cv::Size& size, const std::string& model_path) {
+    if (initialized_) {
+        std::cerr << "⚠️ addInputSize() debe llamarse antes de initialize()" << std::endl;
+        return;
+    }
+    
+    for (DetectorInput& input : inputs_) {
+        if (input.size == size) {
+            input.model_path = model_path;
+            return;
         }
     }
     
-    return detections;
+    inputs_.emplace_back(size, model_path);
+    std::sort(inputs_.begin(), inputs_.end(), [](const DetectorInput& a, const DetectorInput& b) {
+        return a.size.area() < b.size.area();
+    });
+    
+    // El tamaño activo por defecto es el mayor (máximo alcance)
+    active_input_ = inputs_.size() - 1;
+    
+    // Candidatos del tamaño mayor (YOLOv8: 8400 a 640x640)
+    const cv::Size& largest = inputs_.back().size;
+    size_t max_candidates = static_cast<size_t>(largest.area()) * 21 / 1024;
+    candidates_.reserve(max_candidates);
+    nms_.reserve(max_candidates);
 }
 
-std::vector<PlateDetection> PlateDetector::applyNMS(
-    const std::vector<PlateDetection>& detections,
-    float nms_threshold
-) {
-    if (detections.empty()) {
-        return {};
+void PlateDetector::setPrimaryInputSize(const cv::Size& size) {
+    if (initialized_) {
+        std::cerr << "⚠️ setPrimaryInputSize() debe llamarse antes de initialize()" << std::endl;
+        return;
     }
     
-    // Extraer bboxes y confidencias
-    std::vector<cv::Rect> bboxes;
-    std::vector<float> confidences;
-    std::vector<int> indices;
+    inputs_.clear();
+    inputs_.emplace_back(size, "");
+    active_input_ = 0;
     
-    for (const auto& det : detections) {
-        bboxes.push_back(det.bbox);
-        confidences.push_back(det.confidence);
+    size_t max_candidates = static_cast<size_t>(size.area()) * 21 / 1024;
+    candidates_.reserve(max_candidates);
+    nms_.reserve(max_candidates);
+}
+
+bool PlateDetector::setInputSize(const cv::Size& size) {
+    std::shared_lock<std::shared_mutex> lock(model_mutex_);
+    for (size_t i = 0; i < inputs_.size(); ++i) {
+        if (inputs_[i].size == size) {
+            active_input_ = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<cv::Size> PlateDetector::getInputSizes() const {
+    std::shared_lock<std::shared_mutex> lock(model_mutex_);
+    std::vector<cv::Size> sizes;
+    for (const DetectorInput& input : inputs_) {
+        sizes.push_back(input.size);
+    }
+    return sizes;
+}
+
+std::vector<PlateDetection> PlateDetector::applyNMS(const cv::Size& frame_size) {
+    if (candidates_.empty()) {
+        return {};
     }
     
-    // Aplicar NMS usando OpenCV
-    cv::dnn::NMSBoxes(
-        bboxes,
-        confidences,
-        confidence_threshold_,
-        nms_threshold,
-        indices
-    );
+    // NMS sobre los buffers SoA del decodificador (sin volver a filtrar por umbral)
+    const std::vector<int>& keep = nms_.run(candidates_);
     
     // Crear vector de detecciones filtradas
     std::vector<PlateDetection> filtered_detections;
-    for (int idx : indices) {
-        filtered_detections.push_back(detections[idx]);
+    filtered_detections.reserve(keep.size());
+    
+    for (int idx : keep) {
+        // Recortar la caja a los límites del frame
+        int x1 = static_cast<int>(std::max(0.0f, candidates_.x1[idx]));
+        int y1 = static_cast<int>(std::max(0.0f, candidates_.y1[idx]));
+        int x2 = static_cast<int>(std::min(static_cast<float>(frame_size.width), candidates_.x2[idx]));
+        int y2 = static_cast<int>(std::min(static_cast<float>(frame_size.height), candidates_.y2[idx]));
+        
+        if (x2 <= x1 || y2 <= y1) {
+            continue;
+        }
+        
+        filtered_detections.emplace_back(
+            cv::Rect(x1, y1, x2 - x1, y2 - y1),
+            candidates_.scores[idx],
+            candidates_.class_ids[idx]
+        );
     }
     
     return filtered_detections;
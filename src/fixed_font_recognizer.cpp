@@ -0,0 +1,317 @@
+#include "fixed_font_recognizer.h"
+#include "threshold_bank.h"
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+namespace jetson_lpr {
+
+namespace {
+
+// Posiciones con letra: las tres primeras (ABC123); en las diplomáticas
+// (CD1234) la tercera ya es dígito
+constexpr int LETTER_POSITIONS = 3;
+constexpr int PLATE_LENGTH = 6;
+
+bool isLetter(char c) {
+    return c >= 'A' && c <= 'Z';
+}
+
+bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+} // namespace
+
+FixedFontRecognizer::FixedFontRecognizer(const FixedFontConfig& config)
+    : config_(config)
+    , scorer_(6)
+    , initialized_(false)
+{
+    config_.k = std::max(1, config_.k);
+    config_.plate_height = std::max(GLYPH_SIZE * 2, config_.plate_height);
+}
+
+bool FixedFontRecognizer::initialize() {
+    if (initialized_) {
+        return true;
+    }
+
+    if (!loadTemplates(config_.templates_path)) {
+        std::cerr << "⚠️  Sin plantillas de glifos en " << config_.templates_path
+                  << ", usando plantillas dibujadas" << std::endl;
+        renderTemplates();
+    }
+
+    if (letters_.labels.empty() || digits_.labels.empty()) {
+        std::cerr << "Error: el reconocedor de fuente fija necesita plantillas de letras y dígitos" << std::endl;
+        return false;
+    }
+
+    initialized_ = true;
+    std::cout << "✅ Reconocedor de fuente fija listo (" << letters_.labels.size() << " letras, "
+              << digits_.labels.size() << " dígitos, k=" << config_.k << ")" << std::endl;
+    return true;
+}
+
+std::string FixedFontRecognizer::name() const {
+    return "fuente fija (kNN)";
+}
+
+std::vector<OCRResult> FixedFontRecognizer::recognizeBatch(const std::vector<cv::Mat>& plates) {
+    std::vector<OCRResult> results;
+    results.reserve(plates.size());
+    for (const cv::Mat& plate : plates) {
+        results.push_back(recognize(plate));
+    }
+    return results;
+}
+
+OCRResult FixedFontRecognizer::recognize(const cv::Mat& plate) const {
+    OCRResult result;
+    if (!initialized_ || plate.empty()) {
+        return result;
+    }
+
+    cv::Mat foreground;
+    std::vector<cv::Rect> boxes;
+    if (!segment(plate, foreground, boxes)) {
+        return result;
+    }
+
+    float sum = 0.0f;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        const Alphabet& alphabet = i < LETTER_POSITIONS ? letters_ : digits_;
+        const cv::Mat features = glyphFeatures(foreground, boxes[i]);
+
+        float confidence = 0.0f;
+        char c = classify(alphabet, features, confidence);
+
+        // Tras "CD" la tercera puede ser dígito (CD1234): gana el alfabeto
+        // más parecido
+        if (i == LETTER_POSITIONS - 1 && result.text == "CD") {
+            float digit_confidence = 0.0f;
+            char digit = classify(digits_, features, digit_confidence);
+            if (digit != 0 && digit_confidence > confidence) {
+                c = digit;
+                confidence = digit_confidence;
+            }
+        }
+        if (c == 0) {
+            return OCRResult();
+        }
+
+        result.text += c;
+        result.char_confidences.push_back(confidence);
+        sum += confidence;
+    }
+
+    result.confidence = sum / boxes.size();
+    return result;
+}
+
+bool FixedFontRecognizer::segment(const cv::Mat& plate, cv::Mat& foreground, std::vector<cv::Rect>& boxes) const {
+    boxes.clear();
+    if (plate.empty()) {
+        return false;
+    }
+
+    cv::Mat gray;
+    if (plate.channels() == 3) {
+        cv::cvtColor(plate, gray, cv::COLOR_BGR2GRAY);
+    } else if (plate.channels() == 4) {
+        cv::cvtColor(plate, gray, cv::COLOR_BGRA2GRAY);
+    } else {
+        gray = plate;
+    }
+
+    // Alto fijo: mismos tamaños de componente para placas cercanas y lejanas
+    const double scale = static_cast<double>(config_.plate_height) / gray.rows;
+    const int width = std::max(1, static_cast<int>(std::lround(gray.cols * scale)));
+    cv::Mat normalized;
+    cv::resize(gray, normalized, cv::Size(width, config_.plate_height), 0, 0,
+               scale < 1.0 ? cv::INTER_AREA : cv::INTER_LINEAR);
+
+    thread_local ThresholdBank bank;
+    bank.compute(normalized);
+
+    // Otsu si la iluminación es pareja, adaptativo si hay sombras
+    float best_score = -1.0f;
+    for (int strategy : {ThresholdBank::OTSU, ThresholdBank::ADAPTIVE_GAUSS}) {
+        std::vector<cv::Rect> characters;
+        bool dark_text = true;
+        BinarizationScore score = scorer_.segment(bank.plane(strategy), characters, dark_text);
+
+        if (characters.size() == PLATE_LENGTH && score.score > best_score) {
+            best_score = score.score;
+            boxes.swap(characters);
+            if (dark_text) {
+                cv::bitwise_not(bank.plane(strategy), foreground);
+            } else {
+                bank.plane(strategy).copyTo(foreground);
+            }
+        }
+    }
+
+    return !boxes.empty();
+}
+
+cv::Mat FixedFontRecognizer::glyphFeatures(const cv::Mat& foreground, const cv::Rect& box) {
+    cv::Mat features = cv::Mat::zeros(1, GLYPH_SIZE * GLYPH_SIZE, CV_32F);
+    cv::Rect roi = box & cv::Rect(0, 0, foreground.cols, foreground.rows);
+    if (roi.empty()) {
+        return features;
+    }
+
+    // Centrar en un cuadrado: conserva la proporción (1 e I no se estiran)
+    const int side = std::max(roi.width, roi.height);
+    cv::Mat square = cv::Mat::zeros(side, side, CV_8UC1);
+    cv::Mat centered = square(cv::Rect((side - roi.width) / 2, (side - roi.height) / 2, roi.width, roi.height));
+    foreground(roi).copyTo(centered);
+
+    cv::Mat glyph;
+    cv::resize(square, glyph, cv::Size(GLYPH_SIZE, GLYPH_SIZE), 0, 0, cv::INTER_AREA);
+    glyph.reshape(1, 1).convertTo(features, CV_32F);
+
+    // Norma 1: el producto punto es la similitud coseno
+    double norm = cv::norm(features, cv::NORM_L2);
+    if (norm > 0.0) {
+        features *= 1.0 / norm;
+    }
+    return features;
+}
+
+void FixedFontRecognizer::addSample(const cv::Mat& features, char label) {
+    Alphabet* alphabet = isLetter(label) ? &letters_ : isDigit(label) ? &digits_ : nullptr;
+    if (!alphabet || features.total() != GLYPH_SIZE * GLYPH_SIZE) {
+        return;
+    }
+
+    alphabet->samples.push_back(features.reshape(1, 1));
+    alphabet->labels.push_back(label);
+}
+
+bool FixedFontRecognizer::saveTemplates(const std::string& path) const {
+    cv::FileStorage fs(path, cv::FileStorage::WRITE);
+    if (!fs.isOpened()) {
+        return false;
+    }
+
+    fs << "glyph_size" << GLYPH_SIZE;
+    fs << "letter_labels" << std::string(letters_.labels.begin(), letters_.labels.end());
+    fs << "letters" << letters_.samples;
+    fs << "digit_labels" << std::string(digits_.labels.begin(), digits_.labels.end());
+    fs << "digits" << digits_.samples;
+    fs.release();
+    return true;
+}
+
+bool FixedFontRecognizer::loadTemplates(const std::string& path) {
+    if (path.empty() || !std::ifstream(path).good()) {
+        return false;
+    }
+
+    try {
+        cv::FileStorage fs(path, cv::FileStorage::READ);
+        if (!fs.isOpened() || static_cast<int>(fs["glyph_size"]) != GLYPH_SIZE) {
+            return false;
+        }
+
+        Alphabet letters;
+        Alphabet digits;
+        std::string letter_labels;
+        std::string digit_labels;
+        fs["letter_labels"] >> letter_labels;
+        fs["letters"] >> letters.samples;
+        fs["digit_labels"] >> digit_labels;
+        fs["digits"] >> digits.samples;
+
+        if (letters.samples.rows != static_cast<int>(letter_labels.size()) ||
+            digits.samples.rows != static_cast<int>(digit_labels.size())) {
+            return false;
+        }
+
+        letters.labels.assign(letter_labels.begin(), letter_labels.end());
+        digits.labels.assign(digit_labels.begin(), digit_labels.end());
+        letters_ = std::move(letters);
+        digits_ = std::move(digits);
+        return true;
+
+    } catch (const cv::Exception& e) {
+        std::cerr << "Error al leer plantillas de glifos: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void FixedFontRecognizer::renderTemplates() {
+    letters_ = Alphabet();
+    digits_ = Alphabet();
+
+    const std::string characters = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    const int fonts[] = {cv::FONT_HERSHEY_SIMPLEX, cv::FONT_HERSHEY_DUPLEX};
+    const int thicknesses[] = {3, 5, 7};
+
+    // Dibujar cada carácter grande y tomar su caja, como hace segment()
+    cv::Mat canvas(96, 96, CV_8UC1);
+    for (char c : characters) {
+        for (int font : fonts) {
+            for (int thickness : thicknesses) {
+                canvas.setTo(cv::Scalar(0));
+                cv::putText(canvas, std::string(1, c), cv::Point(16, 76), font, 2.4,
+                            cv::Scalar(255), thickness, cv::LINE_AA);
+
+                std::vector<cv::Point> ink;
+                cv::findNonZero(canvas, ink);
+                if (ink.empty()) {
+                    continue;
+                }
+                addSample(glyphFeatures(canvas, cv::boundingRect(ink)), c);
+            }
+        }
+    }
+}
+
+char FixedFontRecognizer::classify(const Alphabet& alphabet, const cv::Mat& features, float& confidence) const {
+    confidence = 0.0f;
+    if (alphabet.labels.empty()) {
+        return 0;
+    }
+
+    // Similitud con todas las plantillas en una multiplicación (N x 1)
+    cv::Mat similarities;
+    cv::gemm(alphabet.samples, features, 1.0, cv::noArray(), 0.0, similarities, cv::GEMM_2_T);
+    const float* similarity = similarities.ptr<float>();
+
+    const size_t k = std::min(static_cast<size_t>(config_.k), alphabet.labels.size());
+    std::vector<int> order(alphabet.labels.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::partial_sort(order.begin(), order.begin() + k, order.end(),
+                      [similarity](int a, int b) { return similarity[a] > similarity[b]; });
+
+    // Voto ponderado por similitud
+    float votes[128] = {0.0f};
+    float best_similarity[128] = {0.0f};
+    float total = 0.0f;
+    for (size_t i = 0; i < k; ++i) {
+        const int label = static_cast<unsigned char>(alphabet.labels[order[i]]) & 0x7F;
+        const float s = std::max(0.0f, similarity[order[i]]);
+        votes[label] += s;
+        best_similarity[label] = std::max(best_similarity[label], s);
+        total += s;
+    }
+
+    int winner = static_cast<unsigned char>(alphabet.labels[order[0]]) & 0x7F;
+    for (int label = 0; label < 128; ++label) {
+        if (votes[label] > votes[winner]) {
+            winner = label;
+        }
+    }
+
+    // Vecinos de acuerdo y glifo parecido a su plantilla
+    confidence = total > 0.0f ? votes[winner] / total * best_similarity[winner] : 0.0f;
+    return static_cast<char>(winner);
+}
+
+} // namespace jetson_lpr
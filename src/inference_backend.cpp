@@ -0,0 +1,66 @@
+#include "inference_backend.h"
+#include "opencv_dnn_backend.h"
+#include "onnxruntime_backend.h"
+#include "openvino_backend.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+
+namespace jetson_lpr {
+
+std::string detectModelPrecision(const std::string& model_path) {
+    std::ifstream file(model_path, std::ios::binary);
+    if (!file.is_open()) {
+        return "fp32";
+    }
+    
+    // Los op_type del grafo ONNX se guardan como strings en el protobuf
+    // Lectura por bloques; cada bloque repite los últimos marker.size()-1
+    // bytes del anterior para no perder un marcador partido entre dos
+    static const std::string marker = "DequantizeLinear";
+    const size_t overlap = marker.size() - 1;
+    std::vector<char> buffer(1 << 20);
+    size_t carried = 0;
+    
+    while (file) {
+        file.read(buffer.data() + carried, static_cast<std::streamsize>(buffer.size() - carried));
+        const size_t filled = carried + static_cast<size_t>(file.gcount());
+        if (filled < marker.size()) {
+            break;
+        }
+        
+        auto chunk_end = buffer.begin() + filled;
+        if (std::search(buffer.begin(), chunk_end, marker.begin(), marker.end()) != chunk_end) {
+            return "int8";
+        }
+        
+        std::copy(chunk_end - overlap, chunk_end, buffer.begin());
+        carried = overlap;
+    }
+    
+    return "fp32";
+}
+
+std::unique_ptr<InferenceBackend> createInferenceBackend(const InferenceOptions& options) {
+    if (options.backend == "onnxruntime" || options.backend == "ort") {
+        #ifdef USE_ONNXRUNTIME
+        return std::make_unique<OnnxRuntimeBackend>(options);
+        #else
+        std::cerr << "⚠️ Backend 'onnxruntime' no compilado (USE_ONNXRUNTIME=OFF), usando OpenCV DNN" << std::endl;
+        #endif
+    } else if (options.backend == "openvino") {
+        #ifdef USE_OPENVINO
+        return std::make_unique<OpenVINOBackend>(options);
+        #else
+        std::cerr << "⚠️ Backend 'openvino' no compilado (USE_OPENVINO=OFF), usando OpenCV DNN" << std::endl;
+        #endif
+    } else if (options.backend != "opencv") {
+        std::cerr << "⚠️ Backend de inferencia desconocido: " << options.backend
+                  << ", usando OpenCV DNN" << std::endl;
+    }
+
+    return std::make_unique<OpenCVDnnBackend>(options);
+}
+
+} // namespace jetson_lpr
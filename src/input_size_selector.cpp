@@ -0,0 +1,64 @@
+#include "input_size_selector.h"
+#include <algorithm>
+
+namespace jetson_lpr {
+
+InputSizeSelector::InputSizeSelector(const std::vector<cv::Size>& sizes,
+                                     float min_plate_px,
+                                     int window_frames,
+                                     int probe_interval)
+    : sizes_(sizes)
+    , min_plate_px_(min_plate_px)
+    , window_frames_(static_cast<uint64_t>(std::max(1, window_frames)))
+    , probe_interval_(static_cast<uint64_t>(std::max(0, probe_interval)))
+    , frame_count_(0)
+{
+    std::sort(sizes_.begin(), sizes_.end(), [](const cv::Size& a, const cv::Size& b) {
+        return a.area() < b.area();
+    });
+}
+
+void InputSizeSelector::report(const std::vector<PlateDetection>& detections, const cv::Size& frame_size) {
+    if (frame_size.height <= 0) {
+        return;
+    }
+
+    for (const PlateDetection& detection : detections) {
+        recent_.push_back({
+            frame_count_,
+            static_cast<float>(detection.bbox.height) / frame_size.height
+        });
+    }
+}
+
+cv::Size InputSizeSelector::select() {
+    const uint64_t frame = frame_count_++;
+
+    // Olvidar placas fuera de la ventana
+    while (!recent_.empty() && recent_.front().frame + window_frames_ < frame) {
+        recent_.pop_front();
+    }
+
+    const cv::Size& largest = sizes_.back();
+    bool probe = probe_interval_ > 0 && frame % probe_interval_ == 0;
+
+    if (sizes_.size() == 1 || recent_.empty() || probe) {
+        return largest;
+    }
+
+    float smallest_plate = recent_.front().relative_height;
+    for (const Observation& observation : recent_) {
+        smallest_plate = std::min(smallest_plate, observation.relative_height);
+    }
+
+    // Menor tamaño donde la placa más pequeña sigue siendo detectable
+    for (const cv::Size& size : sizes_) {
+        if (smallest_plate * size.height >= min_plate_px_) {
+            return size;
+        }
+    }
+
+    return largest;
+}
+
+} // namespace jetson_lpr
@@ -1,9 +1,12 @@
 #include "lpr_system.h"
+#include "ctc_plate_recognizer.h"
+#include "fixed_font_recognizer.h"
 #include <iostream>
 #include <algorithm>
 #include <iomanip>
 #include <sstream>
 #include <unordered_map>
+#include <future>
 
 namespace jetson_lpr {
 
@@ -12,10 +15,13 @@ LPRSystem::LPRSystem(const std::string& config_path)
     , running_(false)
     , initialized_(false)
     , max_queue_size_(3)
+    , async_detection_(false)
     , cooldown_seconds_(0.5)
+    , ocr_cache_enabled_(true)
     , frame_counter_(0)
     , ai_frame_counter_(0)
     , detection_counter_(0)
+    , first_decision_done_(false)
     , display_enabled_(true)
     , display_scale_(0.3)
     , window_name_("Sistema LPR - Reconocimiento de Placas")
@@ -52,49 +58,319 @@ bool LPRSystem::initialize() {
     auto processing_config = config_.getProcessingConfig();
     auto database_config = config_.getDatabaseConfig();
     
-    // Inicializar captura de video
+    // Cámara, OCR y base de datos no dependen del detector ni entre sí:
+    // se inicializan en paralelo mientras el detector carga en este hilo
     std::cout << "📹 Inicializando captura de video..." << std::endl;
-    video_capture_ = std::make_unique<VideoCapture>(camera_config.rtsp_url, 2);
-    if (!video_capture_->start()) {
-        std::cerr << "Error: No se pudo iniciar la captura de video" << std::endl;
-        return false;
-    }
+    auto capture_ready = std::async(std::launch::async, [this, &camera_config]() {
+        return startup_timeline_.measure("captura RTSP", [this, &camera_config]() {
+            video_capture_ = std::make_unique<VideoCapture>(camera_config.rtsp_url, 2);
+            return video_capture_->start();
+        });
+    });
+    
+    std::cout << "📝 Inicializando OCR..." << std::endl;
+    auto ocr_ready = std::async(std::launch::async, [this, &processing_config]() {
+        return startup_timeline_.measure("OCR (Tesseract)", [this, &processing_config]() {
+            ocr_processor_ = std::make_unique<OCRProcessor>(
+                "eng", "", static_cast<size_t>(std::max(0, config_.getInt("ocr.engines", 0)))
+            );
+            
+            // Reconocedor CTC (CRNN / LPRNet) en lugar de Tesseract
+            if (config_.getString("ocr.engine", "tesseract") == "crnn") {
+                CTCRecognizerConfig crnn_config;
+                crnn_config.model_path = config_.getString("ocr.crnn.model_path", "models/plate_recognizer.onnx");
+                crnn_config.input_width = config_.getInt("ocr.crnn.input_width", 94);
+                crnn_config.input_height = config_.getInt("ocr.crnn.input_height", 24);
+                crnn_config.channels = config_.getInt("ocr.crnn.channels", 3);
+                crnn_config.swap_rb = config_.getBool("ocr.crnn.swap_rb", false);
+                crnn_config.mean = config_.getDouble("ocr.crnn.mean", 127.5);
+                crnn_config.scale = config_.getDouble("ocr.crnn.scale", 0.0078125);
+                crnn_config.alphabet = config_.getString("ocr.crnn.alphabet", crnn_config.alphabet);
+                crnn_config.blank_index = config_.getInt("ocr.crnn.blank_index", 0);
+                crnn_config.output_layout = config_.getString("ocr.crnn.output_layout", "auto");
+                crnn_config.max_batch = config_.getInt("ocr.crnn.max_batch", 8);
+                crnn_config.beam_width = config_.getInt("ocr.crnn.beam_width", 1);
+                crnn_config.inference.backend = config_.getString("ocr.crnn.backend", "opencv");
+                crnn_config.inference.intra_op_threads = config_.getInt("ocr.crnn.intra_op_threads", 0);
+                crnn_config.inference.use_cuda = config_.getBool("ocr.crnn.use_cuda", true);
+                crnn_config.inference.device = config_.getString("ocr.crnn.device", "CPU");
+                ocr_processor_->setRecognizer(std::make_unique<CTCPlateRecognizer>(crnn_config));
+            }
+            
+            // Ruta rápida: segmentación y kNN con la fuente de las placas
+            if (config_.getBool("ocr.fixed_font.enabled", false)) {
+                FixedFontConfig font_config;
+                font_config.templates_path = config_.getString("ocr.fixed_font.templates", "models/plate_glyphs.yml");
+                font_config.k = config_.getInt("ocr.fixed_font.k", 3);
+                ocr_processor_->setFastPath(
+                    std::make_unique<FixedFontRecognizer>(font_config),
+                    static_cast<float>(config_.getDouble("ocr.fixed_font.accept_confidence", 0.8))
+                );
+            }
+            
+            if (!ocr_processor_->initialize()) {
+                return false;
+            }
+            ocr_processor_->setConfidenceThreshold(
+                static_cast<float>(processing_config.plate_confidence_min)
+            );
+            ocr_processor_->setTargetConfidence(
+                static_cast<float>(config_.getDouble("ocr.target_confidence", 0.9))
+            );
+            ocr_processor_->setValidConfidence(
+                static_cast<float>(config_.getDouble("ocr.valid_confidence", 0.6))
+            );
+            ocr_processor_->setLayoutSubstitutionConfidence(
+                static_cast<float>(config_.getDouble("ocr.layout_substitution_confidence", 0.4))
+            );
+            ocr_processor_->setDeterministic(config_.getBool("ocr.deterministic", false));
+            ocr_processor_->setPreselection(config_.getInt("ocr.preselect_top", 0));
+            
+            TextBandConfig band_config;
+            band_config.min_transitions = config_.getInt("ocr.text_band.min_transitions", 8);
+            band_config.peak_ratio = static_cast<float>(config_.getDouble("ocr.text_band.peak_ratio", 0.35));
+            band_config.min_band_ratio = static_cast<float>(config_.getDouble("ocr.text_band.min_band_ratio", 0.3));
+            band_config.margin = static_cast<float>(config_.getDouble("ocr.text_band.margin", 0.1));
+            ocr_processor_->setTextBand(config_.getBool("ocr.text_band.enabled", false), band_config);
+            
+            OCRCacheConfig cache_config;
+            cache_config.max_entries = static_cast<size_t>(std::max(0, config_.getInt("ocr.cache_entries", 100)));
+            cache_config.max_bytes = static_cast<size_t>(std::max(0, config_.getInt("ocr.cache_max_bytes", 0)));
+            cache_config.ttl_seconds = config_.getDouble("ocr.cache_ttl_seconds", 10.0);
+            cache_config.max_distance = config_.getInt("ocr.cache_max_distance", 1);
+            cache_config.stripes = config_.getInt("ocr.cache_stripes", 4);
+            ocr_processor_->setCacheConfig(cache_config);
+            return true;
+        });
+    });
+    
+    std::cout << "💾 Inicializando base de datos..." << std::endl;
+    auto database_ready = std::async(std::launch::async, [this, &database_config]() {
+        return startup_timeline_.measure("MySQL", [this, &database_config]() {
+            db_manager_ = std::make_unique<DatabaseManager>();
+            return db_manager_->connect(
+                database_config.host,
+                database_config.port,
+                database_config.database,
+                database_config.user,
+                database_config.password
+            );
+        });
+    });
     
     // Inicializar detector (necesita modelo YOLO convertido a ONNX)
     std::cout << "🔍 Inicializando detector de placas..." << std::endl;
-    // TODO: Obtener ruta del modelo desde configuración o usar path por defecto
-    std::string model_path = "models/license_plate_detector.onnx";  // Cambiar según tu modelo
+    std::string model_path = config_.getString("detector.model_path", "models/license_plate_detector.onnx");
+    
+    // Backend de inferencia (se elige por configuración, sin recompilar)
+    InferenceOptions inference_options;
+    inference_options.backend = config_.getString("detector.backend", "opencv");
+    inference_options.intra_op_threads = config_.getInt("detector.intra_op_threads", 0);
+    inference_options.inter_op_threads = config_.getInt("detector.inter_op_threads", 0);
+    inference_options.graph_optimization = config_.getBool("detector.graph_optimization", true);
+    inference_options.optimized_model_cache = config_.getString("detector.optimized_model_cache", "");
+    inference_options.use_cuda = config_.getBool("detector.use_cuda", true);
+    inference_options.device = config_.getString("detector.device", "CPU");
+    inference_options.num_requests = config_.getInt("detector.num_requests", 4);
+    inference_options.precision = config_.getString("detector.precision", "auto");
+    
     detector_ = std::make_unique<PlateDetector>(
         model_path, 
-        static_cast<float>(processing_config.confidence_threshold)
+        static_cast<float>(processing_config.confidence_threshold),
+        inference_options
     );
-    if (!detector_->initialize()) {
+    
+    NMSConfig nms_config;
+    nms_config.iou_threshold = static_cast<float>(config_.getDouble("detector.nms_threshold", 0.5));
+    nms_config.top_k = config_.getInt("detector.nms_top_k", 300);
+    nms_config.max_detections = config_.getInt("detector.max_detections", 100);
+    nms_config.class_aware = config_.getBool("detector.nms_class_aware", false);
+    nms_config.soft_nms = config_.getBool("detector.soft_nms", false);
+    nms_config.soft_sigma = static_cast<float>(config_.getDouble("detector.soft_nms_sigma", 0.5));
+    nms_config.soft_min_score = static_cast<float>(config_.getDouble("detector.soft_nms_min_score", 0.001));
+    detector_->setNMSConfig(nms_config);
+    
+    // Tamaños de entrada adicionales (modelo de forma dinámica o exportados por tamaño)
+    std::vector<double> input_sizes = config_.getDoubleArray("detector.input_sizes");
+    for (size_t i = 0; i < input_sizes.size(); ++i) {
+        int side = static_cast<int>(input_sizes[i]);
+        detector_->addInputSize(
+            cv::Size(side, side),
+            config_.getString("detector.input_models." + std::to_string(i), "")
+        );
+    }
+    
+    // Detector de vehículos de la cascada: carga en paralelo con el de placas
+    std::future<bool> vehicle_ready;
+    if (config_.getBool("cascade.enabled", false)) {
+        vehicle_ready = std::async(std::launch::async, [this, inference_options]() {
+            return startup_timeline_.measure("detector de vehículos", [this, &inference_options]() {
+                return initializeVehicleDetector(inference_options);
+            });
+        });
+    }
+    
+    // initialize() incluye una inferencia de calentamiento por tamaño de entrada
+    bool detector_ok = startup_timeline_.measure("detector de placas (carga + calentamiento)", [this]() {
+        return detector_->initialize();
+    });
+    if (!detector_ok) {
         std::cerr << "Error: No se pudo inicializar el detector" << std::endl;
         std::cerr << "Nota: Necesitas convertir el modelo YOLO (.pt) a formato ONNX" << std::endl;
         // No retornar false, permitir continuar sin detector para pruebas
     }
     
-    // Inicializar OCR
-    std::cout << "📝 Inicializando OCR..." << std::endl;
-    ocr_processor_ = std::make_unique<OCRProcessor>("eng");
-    if (!ocr_processor_->initialize()) {
+    // Tamaño fijo para esta cámara (ej. 320 en cámaras de portería cercanas)
+    int input_size = config_.getInt("detector.input_size", 0);
+    if (input_size > 0 && !detector_->setInputSize(cv::Size(input_size, input_size))) {
+        std::cerr << "⚠️ Tamaño de entrada " << input_size << " no está en detector.input_sizes" << std::endl;
+    }
+    
+    // Reemplazo del modelo en caliente (SIGUSR1 o cambio del archivo)
+    model_reloader_ = std::make_unique<ModelReloader>(
+        *detector_,
+        config_.getBool("model_reload.watch_file", true),
+        config_.getDouble("model_reload.poll_interval_sec", 2.0)
+    );
+    
+    // Agrupar en una sola inferencia las solicitudes que llegan juntas
+    // (ventana en ms). Solo la cascada y las teselas envían varias por
+    // frame; con un solo frame por ciclo cada lote sería de 1 y la ventana
+    // solo sumaría latencia
+    int max_batch_size = config_.getInt("detector.max_batch_size", 1);
+    double batch_window_ms = config_.getDouble("detector.batch_window_ms", 0.0);
+    if (max_batch_size > 1 && batch_window_ms > 0.0) {
+        if (config_.getBool("cascade.enabled", false) || config_.getBool("tiling.enabled", false)) {
+            detection_batcher_ = std::make_unique<DetectionBatcher>(
+                *detector_, max_batch_size, batch_window_ms
+            );
+        } else {
+            std::cout << "ℹ️  detector.batch_window_ms sin efecto: sin cascada ni teselas cada frame "
+                      << "es una sola inferencia" << std::endl;
+        }
+    }
+    
+    // Cascada vehículo → placa: placas solo dentro de los vehículos
+    if (vehicle_ready.valid()) {
+        if (vehicle_ready.get()) {
+            CascadeConfig cascade_config;
+            std::vector<double> roi = config_.getDoubleArray("cascade.roi");
+            if (roi.size() == 4) {
+                cascade_config.roi = cv::Rect2f(roi[0], roi[1], roi[2], roi[3]);
+            }
+            cascade_config.crop_margin = static_cast<float>(config_.getDouble("cascade.crop_margin", 0.1));
+            cascade_config.min_vehicle_size = config_.getInt("cascade.min_vehicle_size", 48);
+            cascade_config.max_vehicles = config_.getInt("cascade.max_vehicles", 8);
+            cascade_config.batch_size = config_.getInt("cascade.batch_size", 4);
+            cascade_config.merge_iou = static_cast<float>(config_.getDouble("detector.nms_threshold", 0.5));
+            
+            detection_cascade_ = std::make_unique<DetectionCascade>(
+                *vehicle_detector_, *detector_, cascade_config, detection_batcher_.get()
+            );
+        } else {
+            std::cerr << "⚠️ No se pudo cargar el detector de vehículos, cascada deshabilitada" << std::endl;
+            vehicle_detector_.reset();
+        }
+    }
+    
+    // Detección por teselas a resolución nativa (placas lejanas)
+    // La cascada ya busca placas a resolución nativa dentro de cada vehículo
+    if (!detection_cascade_ && config_.getBool("tiling.enabled", false)) {
+        TilingConfig tiling_config;
+        tiling_config.tile_size = config_.getInt("tiling.tile_size", 640);
+        tiling_config.overlap = static_cast<float>(config_.getDouble("tiling.overlap", 0.2));
+        tiling_config.interval = config_.getInt("tiling.interval", 5);
+        tiling_config.max_tiles_per_run = config_.getInt("tiling.max_tiles_per_run", 0);
+        tiling_config.batch_size = config_.getInt("tiling.batch_size", 4);
+        tiling_config.merge_iou = static_cast<float>(config_.getDouble("tiling.merge_iou", 0.5));
+        
+        // Rectángulos normalizados [x, y, ancho, alto]
+        std::vector<double> roi = config_.getDoubleArray("tiling.roi");
+        if (roi.size() == 4) {
+            tiling_config.roi = cv::Rect2f(roi[0], roi[1], roi[2], roi[3]);
+        }
+        for (size_t i = 0; i < config_.getArraySize("tiling.zones"); ++i) {
+            std::vector<double> zone = config_.getDoubleArray("tiling.zones." + std::to_string(i));
+            if (zone.size() == 4) {
+                tiling_config.zones.emplace_back(zone[0], zone[1], zone[2], zone[3]);
+            }
+        }
+        
+        tiled_detector_ = std::make_unique<TiledDetector>(
+            *detector_, tiling_config, detection_batcher_.get()
+        );
+    }
+    
+    // Tamaño por frame según la altura de las placas recientes (no aplica a recortes)
+    if (!detection_cascade_ &&
+        config_.getString("detector.input_size_mode", "fixed") == "auto" &&
+        detector_->getInputSizes().size() > 1) {
+        input_size_selector_ = std::make_unique<InputSizeSelector>(
+            detector_->getInputSizes(),
+            static_cast<float>(config_.getDouble("detector.min_plate_height_px", 16.0)),
+            config_.getInt("detector.size_window_frames", 30),
+            config_.getInt("detector.size_probe_interval", 15)
+        );
+    }
+    
+    // Inferencia asíncrona (OpenVINO): el OCR se hace al completar cada solicitud
+    async_detection_ = !detection_batcher_ && !detection_cascade_ &&
+                       config_.getBool("detector.async_inference", true) &&
+                       detector_->supportsAsync();
+    
+    // Prefiltro geométrico y de color (descarta cajas ilegibles antes del OCR)
+    if (config_.getBool("prefilter.enabled", true)) {
+        PrefilterConfig prefilter_config;
+        prefilter_config.min_width = config_.getInt("prefilter.min_width", 30);
+        prefilter_config.min_height = config_.getInt("prefilter.min_height", 10);
+        prefilter_config.min_aspect = static_cast<float>(config_.getDouble("prefilter.min_aspect", 1.1));
+        prefilter_config.max_aspect = static_cast<float>(config_.getDouble("prefilter.max_aspect", 6.0));
+        prefilter_config.moto_max_aspect = static_cast<float>(config_.getDouble("prefilter.moto_max_aspect", 1.8));
+        prefilter_config.edge_margin = config_.getInt("prefilter.edge_margin", 2);
+        prefilter_config.color_check = config_.getBool("prefilter.color_check", true);
+        prefilter_config.min_color_ratio = static_cast<float>(config_.getDouble("prefilter.min_color_ratio", 0.25));
+        plate_prefilter_ = std::make_unique<PlatePrefilter>(prefilter_config);
+    }
+    
+    // Rectificación de perspectiva (geometría cacheada por carril)
+    if (config_.getBool("rectification.enabled", false)) {
+        RectifierConfig rectifier_config;
+        rectifier_config.lanes = config_.getInt("rectification.lanes", 4);
+        rectifier_config.margin = static_cast<float>(config_.getDouble("rectification.margin", 0.15));
+        rectifier_config.stable_samples = config_.getInt("rectification.stable_samples", 8);
+        rectifier_config.refresh_every = config_.getInt("rectification.refresh_every", 20);
+        rectifier_config.smoothing = static_cast<float>(config_.getDouble("rectification.smoothing", 0.2));
+        plate_rectifier_ = std::make_unique<PlateRectifier>(rectifier_config);
+    }
+    
+    // Votación por carácter entre frames del mismo vehículo
+    if (config_.getBool("voting.enabled", false)) {
+        PlateVoterConfig voter_config;
+        voter_config.min_reads = config_.getInt("voting.min_reads", 2);
+        voter_config.consensus = static_cast<float>(config_.getDouble("voting.consensus", 0.6));
+        voter_config.max_reads = config_.getInt("voting.max_reads", 6);
+        voter_config.max_center_shift = static_cast<float>(config_.getDouble("voting.max_center_shift", 1.0));
+        voter_config.track_timeout_seconds = config_.getDouble("voting.track_timeout_seconds", 2.0);
+        voter_config.resolved_ttl_seconds = config_.getDouble("voting.resolved_ttl_seconds", 10.0);
+        plate_voter_ = std::make_unique<PlateVoter>(voter_config);
+    }
+    
+    // Esperar los pasos en paralelo (todos, aunque alguno falle)
+    bool capture_ok = capture_ready.get();
+    bool ocr_ok = ocr_ready.get();
+    bool database_ok = database_ready.get();
+    
+    if (!capture_ok) {
+        std::cerr << "Error: No se pudo iniciar la captura de video" << std::endl;
+        return false;
+    }
+    
+    if (!ocr_ok) {
         std::cerr << "Error: No se pudo inicializar el OCR" << std::endl;
         return false;
     }
-    ocr_processor_->setConfidenceThreshold(
-        static_cast<float>(processing_config.plate_confidence_min)
-    );
     
-    // Inicializar base de datos
-    std::cout << "💾 Inicializando base de datos..." << std::endl;
-    db_manager_ = std::make_unique<DatabaseManager>();
-    if (!db_manager_->connect(
-            database_config.host,
-            database_config.port,
-            database_config.database,
-            database_config.user,
-            database_config.password
-        )) {
+    if (!database_ok) {
         std::cerr << "Error: No se pudo conectar a la base de datos" << std::endl;
         std::cerr << "El sistema continuará sin guardar en BD" << std::endl;
         // No retornar false, permitir continuar sin BD
@@ -102,9 +378,11 @@ bool LPRSystem::initialize() {
     
     // Configurar cooldown
     cooldown_seconds_ = processing_config.detection_cooldown_sec;
+    ocr_cache_enabled_ = processing_config.ocr_cache_enabled;
     
     initialized_ = true;
-    std::cout << "✅ Sistema LPR inicializado correctamente" << std::endl;
+    std::cout << "✅ Sistema LPR inicializado correctamente en " << std::fixed << std::setprecision(0)
+              << startup_timeline_.mark("inicialización completa") << " ms" << std::endl;
     
     return true;
 }
@@ -122,6 +400,15 @@ void LPRSystem::start() {
     
     running_ = true;
     start_time_ = std::chrono::steady_clock::now();
+    startup_timeline_.mark("pipeline iniciado");
+    
+    if (detection_batcher_) {
+        detection_batcher_->start();
+    }
+    
+    if (model_reloader_) {
+        model_reloader_->start();
+    }
     
     // Iniciar hilos
     capture_thread_ = std::thread(&LPRSystem::captureThread, this);
@@ -137,6 +424,11 @@ void LPRSystem::stop() {
     
     running_ = false;
     
+    // Una recarga en curso termina antes de detener el pipeline
+    if (model_reloader_) {
+        model_reloader_->stop();
+    }
+    
     // Esperar a que terminen los hilos
     if (capture_thread_.joinable()) {
         capture_thread_.join();
@@ -146,6 +438,23 @@ void LPRSystem::stop() {
         processing_thread_.join();
     }
     
+    if (detection_batcher_) {
+        detection_batcher_->stop();
+    }
+    
+    if (tiled_detector_) {
+        std::cout << "🧩 Teselas promedio por frame: " << std::fixed << std::setprecision(2)
+                  << tiled_detector_->getAverageTilesPerFrame() << std::endl;
+    }
+    
+    // Los callbacks asíncronos referencian al sistema: esperar a que terminen
+    if (detector_) {
+        detector_->waitForPending();
+    }
+    
+    // Frames cuya inferencia terminó después del último ciclo de procesamiento
+    drainCompletedFrames();
+    
     // Detener captura
     if (video_capture_) {
         video_capture_->stop();
@@ -159,6 +468,38 @@ void LPRSystem::stop() {
     std::cout << "🛑 Sistema LPR detenido" << std::endl;
 }
 
+void LPRSystem::requestModelReload(const std::string& model_path) {
+    if (model_reloader_) {
+        model_reloader_->requestReload(model_path);
+    }
+}
+
+bool LPRSystem::initializeVehicleDetector(const InferenceOptions& inference_options) {
+    std::string vehicle_model = config_.getString("cascade.vehicle_model", "models/vehicle_detector.onnx");
+    int vehicle_input = config_.getInt("cascade.vehicle_input_size", 320);
+    
+    // Mismo backend e hilos que el detector de placas
+    vehicle_detector_ = std::make_unique<PlateDetector>(
+        vehicle_model,
+        static_cast<float>(config_.getDouble("cascade.vehicle_confidence", 0.4)),
+        inference_options
+    );
+    vehicle_detector_->setPrimaryInputSize(cv::Size(vehicle_input, vehicle_input));
+    
+    // Clases COCO por defecto: car, motorcycle, bus, truck
+    std::vector<int> vehicle_classes;
+    std::vector<double> classes = config_.getDoubleArray("cascade.vehicle_classes");
+    if (!config_.has("cascade.vehicle_classes")) {
+        classes = {2, 3, 5, 7};
+    }
+    for (double id : classes) {
+        vehicle_classes.push_back(static_cast<int>(id));
+    }
+    vehicle_detector_->setClassFilter(vehicle_classes);
+    
+    return vehicle_detector_->initialize();
+}
+
 LPRSystem::Stats LPRSystem::getStats() const {
     std::lock_guard<std::mutex> lock(stats_mutex_);
     return stats_;
@@ -200,11 +541,17 @@ void LPRSystem::processingThread() {
     std::cout << "🧠 Hilo de procesamiento iniciado" << std::endl;
     
     int ai_every = config_.getInt("realtime_optimization.ai_process_every", 2);
-    int frame_skip_counter = 0;
+    // El primer frame se procesa de inmediato (primera decisión lo antes posible)
+    int frame_skip_counter = std::max(1, ai_every) - 1;
     
     while (running_) {
         cv::Mat frame;
         
+        // OCR y resultados de las detecciones asíncronas ya completadas
+        if (async_detection_) {
+            drainCompletedFrames();
+        }
+        
         // Obtener frame de la cola
         {
             std::lock_guard<std::mutex> lock(frame_queue_mutex_);
@@ -225,48 +572,40 @@ void LPRSystem::processingThread() {
             int processing_resolution = config_.getInt("realtime_optimization.processing_resolution", 800);
             
             // Solo redimensionar si la imagen es significativamente más grande
-            if (frame.cols > processing_resolution * 1.2) {
+            // (la cascada trabaja sobre el frame original)
+            if (!detection_cascade_ && frame.cols > processing_resolution * 1.2) {
                 double scale = static_cast<double>(processing_resolution) / frame.cols;
                 cv::resize(frame, processing_frame, cv::Size(), scale, scale, cv::INTER_LINEAR);
             }
             
-            // Procesar frame
-            std::vector<DetectionResult> results = processFrame(processing_frame);
+            // Procesar frame (los frames teselados se procesan de forma síncrona)
+            bool tiled = tiled_detector_ && tiled_detector_->shouldRun();
             
-            // Escalar resultados de vuelta a la resolución original si fue redimensionado
-            if (processing_frame.cols != frame.cols) {
-                double scale = static_cast<double>(frame.cols) / processing_frame.cols;
-                for (auto& result : results) {
-                    result.plate_bbox.x = static_cast<int>(result.plate_bbox.x * scale);
-                    result.plate_bbox.y = static_cast<int>(result.plate_bbox.y * scale);
-                    result.plate_bbox.width = static_cast<int>(result.plate_bbox.width * scale);
-                    result.plate_bbox.height = static_cast<int>(result.plate_bbox.height * scale);
-                }
+            // Las teselas ya están a resolución nativa: usar siempre el tamaño mayor
+            if (input_size_selector_) {
+                detector_->setInputSize(tiled
+                    ? detector_->getInputSizes().back()
+                    : input_size_selector_->select());
             }
             
-            ai_frame_counter_++;
-            
-            // Procesar resultados
-            for (const auto& result : results) {
-                if (result.valid) {
-                    detection_counter_++;
-                    
-                    std::cout << "🎯 PLACA DETECTADA: " << result.plate_text 
-                              << " (YOLO: " << result.yolo_confidence 
-                              << ", OCR: " << result.ocr_confidence << ")" << std::endl;
-                    
-                    // Guardar en base de datos (asíncrono para no bloquear)
-                    saveDetection(result);
-                }
+            if (detection_cascade_) {
+                std::vector<DetectionResult> results = processFrameCascade(frame);
+                handleResults(frame, results);
+            } else if (tiled) {
+                std::vector<DetectionResult> results = processFrameTiled(frame, processing_frame);
+                handleResults(frame, results);
+            } else if (async_detection_) {
+                // La inferencia continúa en segundo plano mientras se prepara el siguiente frame
+                cv::Size processing_size = processing_frame.size();
+                detector_->detectAsync(processing_frame,
+                    [this, frame, processing_size](std::vector<PlateDetection> detections) {
+                        std::lock_guard<std::mutex> lock(completed_frames_mutex_);
+                        completed_frames_.push(CompletedFrame{frame, processing_size, std::move(detections)});
+                    });
+            } else {
+                std::vector<DetectionResult> results = processFrame(frame, processing_frame);
+                handleResults(frame, results);
             }
-            
-            // Mostrar frame en ventana (si está habilitado)
-            if (display_enabled_) {
-                displayFrame(frame, results);
-            }
-            
-            // Actualizar estadísticas
-            updateStats();
         } else {
             // Mostrar frame incluso si no se procesa con IA (para visualización fluida)
             // Pero solo cada 2 frames para no saturar
@@ -281,19 +620,133 @@ void LPRSystem::processingThread() {
     std::cout << "🧠 Hilo de procesamiento terminado" << std::endl;
 }
 
-std::vector<DetectionResult> LPRSystem::processFrame(const cv::Mat& frame) {
-    std::vector<DetectionResult> results;
+void LPRSystem::handleResults(const cv::Mat& frame,
+                              const std::vector<DetectionResult>& results) {
+    ai_frame_counter_++;
     
+    // Tiempo desde el lanzamiento hasta el primer frame analizado
+    if (!first_decision_done_) {
+        first_decision_done_ = true;
+        double first_decision_ms = startup_timeline_.mark("primera decisión");
+        {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            stats_.time_to_first_decision_ms = first_decision_ms;
+        }
+        startup_timeline_.print();
+    }
+    
+    // Procesar resultados
+    for (const auto& result : results) {
+        if (result.valid) {
+            detection_counter_++;
+    
+            std::cout << "🎯 PLACA DETECTADA: " << result.plate_text 
+                      << " (YOLO: " << result.yolo_confidence 
+                      << ", OCR: " << result.ocr_confidence << ")" << std::endl;
+    
+            // Guardar en base de datos (asíncrono para no bloquear)
+            saveDetection(result);
+        }
+    }
+    
+    // Mostrar frame en ventana (si está habilitado)
+    if (display_enabled_) {
+        displayFrame(frame, results);
+    }
+    
+    // Actualizar estadísticas
+    updateStats();
+}
+
+void LPRSystem::drainCompletedFrames() {
+    std::queue<CompletedFrame> completed;
+    {
+        std::lock_guard<std::mutex> lock(completed_frames_mutex_);
+        std::swap(completed, completed_frames_);
+    }
+    
+    while (!completed.empty()) {
+        CompletedFrame& item = completed.front();
+        std::vector<DetectionResult> results = processDetections(
+            item.frame, mapDetectionsToFrame(item.detections, item.processing_size, item.frame.size())
+        );
+        handleResults(item.frame, results);
+        completed.pop();
+    }
+}
+
+std::vector<DetectionResult> LPRSystem::processFrame(const cv::Mat& frame,
+                                                     const cv::Mat& processing_frame) {
+    if (!detector_) {
+        return {};
+    }
+    
+    // Detectar placas con YOLO en el frame reducido
+    std::vector<PlateDetection> detections = detector_->detect(processing_frame);
+    
+    // Recortar las placas del frame original: más píxeles para el OCR
+    return processDetections(frame, mapDetectionsToFrame(detections, processing_frame.size(), frame.size()));
+}
+
+std::vector<DetectionResult> LPRSystem::processFrameTiled(const cv::Mat& frame,
+                                                          const cv::Mat& processing_frame) {
     if (!detector_) {
-        return results;
+        return {};
+    }
+    
+    // Frame completo reducido (placas cercanas) + teselas nativas (placas
+    // lejanas); con batcher el frame reducido va en el mismo lote que las teselas
+    std::vector<PlateDetection> detections;
+    std::vector<PlateDetection> tiled;
+    if (detection_batcher_) {
+        std::future<std::vector<PlateDetection>> full = detection_batcher_->submit(processing_frame);
+        tiled = tiled_detector_->detect(frame);
+        detections = full.get();
+    } else {
+        detections = detector_->detect(processing_frame);
+        tiled = tiled_detector_->detect(frame);
     }
     
-    // Detectar placas con YOLO
-    std::vector<PlateDetection> detections = detector_->detect(frame);
+    // El OCR usa el frame original: más píxeles para placas pequeñas
+    return processDetections(frame, tiled_detector_->merge(
+        mapDetectionsToFrame(detections, processing_frame.size(), frame.size()), tiled
+    ));
+}
+
+std::vector<DetectionResult> LPRSystem::processFrameCascade(const cv::Mat& frame) {
+    std::vector<CascadeDetection> cascade_detections = detection_cascade_->detect(frame);
+    
+    std::vector<PlateDetection> detections;
+    std::vector<cv::Rect> vehicle_boxes;
+    detections.reserve(cascade_detections.size());
+    vehicle_boxes.reserve(cascade_detections.size());
+    for (const CascadeDetection& detection : cascade_detections) {
+        detections.push_back(detection.plate);
+        vehicle_boxes.push_back(detection.vehicle_bbox);
+    }
     
-    for (const auto& detection : detections) {
+    return processDetections(frame, detections, vehicle_boxes);
+}
+
+std::vector<DetectionResult> LPRSystem::processDetections(const cv::Mat& frame,
+                                                          const std::vector<PlateDetection>& detections,
+                                                          const std::vector<cv::Rect>& vehicle_boxes) {
+    std::vector<DetectionResult> results;
+    
+    if (input_size_selector_) {
+        input_size_selector_->report(detections, frame.size());
+    }
+    
+    // Primera pasada: recortes que llegan al OCR
+    std::vector<DetectionResult> pending;
+    std::vector<cv::Mat> plate_rois;
+    for (size_t i = 0; i < detections.size(); ++i) {
+        const PlateDetection& detection = detections[i];
         DetectionResult result;
         result.plate_bbox = detection.bbox;
+        if (i < vehicle_boxes.size()) {
+            result.vehicle_bbox = vehicle_boxes[i];
+        }
         result.yolo_confidence = detection.confidence;
         result.timestamp = std::chrono::system_clock::now();
         
@@ -310,10 +763,87 @@ std::vector<DetectionResult> LPRSystem::processFrame(const cv::Mat& frame) {
             continue;
         }
         
-        cv::Mat plate_roi = frame(roi);
+        if (plate_prefilter_) {
+            PrefilterResult prefilter = plate_prefilter_->evaluate(frame, detection.bbox);
+            if (!prefilter.accepted) {
+                continue;
+            }
+            result.plate_type = PlatePrefilter::plateTypeName(prefilter.type);
+        }
+        
+        pending.push_back(result);
+        // Placa frontal si la cámara la ve en ángulo
+        plate_rois.push_back(plate_rectifier_ ? plate_rectifier_->rectify(frame, roi) : frame(roi));
+    }
+    
+    // Placa lista para registrar: cooldown y autorización
+    auto accept = [this, &results](DetectionResult& result, const std::string& normalized) {
+        result.plate_text = normalized;
+        result.valid = PlateValidator::isValidColombianFormat(normalized);
+        
+        // Verificar cooldown
+        if (!checkCooldown(normalized)) {
+            return;
+        }
+        
+        // Verificar autorización (si hay BD)
+        if (db_manager_ && db_manager_->isConnected()) {
+            result.authorized = db_manager_->isAuthorized(normalized);
+        }
         
-        // Reconocer texto con OCR
-        OCRResult ocr_result = ocr_processor_->recognizeMultipleAttempts(plate_roi);
+        results.push_back(result);
+    };
+    
+    // Vehículos con placa ya decidida por votación no vuelven al OCR
+    std::vector<int> track_ids;
+    if (plate_voter_) {
+        std::vector<cv::Rect> boxes;
+        std::vector<float> scores;
+        boxes.reserve(pending.size());
+        scores.reserve(pending.size());
+        for (const DetectionResult& result : pending) {
+            boxes.push_back(result.plate_bbox);
+            scores.push_back(result.yolo_confidence);
+        }
+        std::vector<VoteDecision> expired;
+        std::vector<int> assigned = plate_voter_->assign(boxes, scores, expired);
+        
+        // Vehículos que se fueron sin consenso: su placa por mayoría
+        for (const VoteDecision& decision : expired) {
+            DetectionResult result;
+            result.plate_bbox = decision.box;
+            result.vehicle_bbox = decision.vehicle_box;
+            result.plate_type = decision.plate_type;
+            result.yolo_confidence = decision.detection_confidence;
+            result.ocr_confidence = decision.confidence;
+            result.timestamp = std::chrono::system_clock::now();
+            accept(result, decision.text);
+        }
+        
+        size_t kept = 0;
+        for (size_t i = 0; i < pending.size(); ++i) {
+            if (plate_voter_->isResolved(assigned[i])) {
+                continue;
+            }
+            pending[kept] = pending[i];
+            plate_rois[kept] = plate_rois[i];
+            track_ids.push_back(assigned[i]);
+            kept++;
+        }
+        pending.resize(kept);
+        plate_rois.resize(kept);
+    }
+    
+    // Reconocer texto con OCR: todas las placas del frame juntas (un solo
+    // lote si el motor es un reconocedor CTC). Con votación, sin cache: el
+    // acierto del frame siguiente repetiría la misma lectura como si fuera
+    // otra independiente (los vehículos decididos ya no llegan al OCR)
+    std::vector<OCRResult> ocr_results = ocr_processor_->recognizeBatch(
+        plate_rois, ocr_cache_enabled_ && !plate_voter_);
+    
+    for (size_t i = 0; i < pending.size(); ++i) {
+        DetectionResult& result = pending[i];
+        const OCRResult& ocr_result = ocr_results[i];
         
         if (ocr_result.text.empty()) {
             continue;
@@ -328,20 +858,22 @@ std::vector<DetectionResult> LPRSystem::processFrame(const cv::Mat& frame) {
             continue;
         }
         
-        result.plate_text = normalized;
-        result.valid = PlateValidator::isValidColombianFormat(normalized);
-        
-        // Verificar cooldown
-        if (!checkCooldown(normalized)) {
-            continue;
-        }
-        
-        // Verificar autorización (si hay BD)
-        if (db_manager_ && db_manager_->isConnected()) {
-            result.authorized = db_manager_->isAuthorized(normalized);
+        // Votación: la placa sale cuando las lecturas del vehículo coinciden
+        if (plate_voter_) {
+            const std::vector<float> no_confidences;
+            VoteDecision decision = plate_voter_->vote(
+                track_ids[i], normalized,
+                ocr_result.text == normalized ? ocr_result.char_confidences : no_confidences,
+                ocr_result.confidence, result.vehicle_bbox, result.plate_type
+            );
+            if (!decision.emit) {
+                continue;
+            }
+            normalized = decision.text;
+            result.ocr_confidence = decision.confidence;
         }
         
-        results.push_back(result);
+        accept(result, normalized);
     }
     
     return results;
@@ -356,6 +888,7 @@ void LPRSystem::saveDetection(const DetectionResult& result) {
     detection.plate_text = result.plate_text;
     detection.yolo_confidence = result.yolo_confidence;
     detection.ocr_confidence = result.ocr_confidence;
+    detection.plate_type = result.plate_type;
     
     detection.plate_bbox[0] = result.plate_bbox.x;
     detection.plate_bbox[1] = result.plate_bbox.y;
@@ -363,10 +896,11 @@ void LPRSystem::saveDetection(const DetectionResult& result) {
     detection.plate_bbox[3] = result.plate_bbox.height;
     
     // Vehicle bbox (mismo que plate si no hay detección separada)
-    detection.vehicle_bbox[0] = result.vehicle_bbox.x > 0 ? result.vehicle_bbox.x : result.plate_bbox.x;
-    detection.vehicle_bbox[1] = result.vehicle_bbox.y > 0 ? result.vehicle_bbox.y : result.plate_bbox.y;
-    detection.vehicle_bbox[2] = result.vehicle_bbox.width > 0 ? result.vehicle_bbox.width : result.plate_bbox.width;
-    detection.vehicle_bbox[3] = result.vehicle_bbox.height > 0 ? result.vehicle_bbox.height : result.plate_bbox.height;
+    const cv::Rect& vehicle = result.vehicle_bbox.area() > 0 ? result.vehicle_bbox : result.plate_bbox;
+    detection.vehicle_bbox[0] = vehicle.x;
+    detection.vehicle_bbox[1] = vehicle.y;
+    detection.vehicle_bbox[2] = vehicle.width;
+    detection.vehicle_bbox[3] = vehicle.height;
     
     auto camera_config = config_.getCameraConfig();
     detection.camera_location = "entrada_principal";
@@ -427,6 +961,34 @@ void LPRSystem::updateStats() {
     stats_.detections_count = detection_counter_;
     stats_.capture_fps = frame_counter_ / elapsed;
     stats_.ai_fps = ai_frame_counter_ / elapsed;
+    
+    if (ocr_processor_) {
+        stats_.ocr_strategies = ocr_processor_->getStrategyStats();
+        stats_.ocr_cache = ocr_processor_->getCacheStats();
+    }
+    
+    if (plate_rectifier_) {
+        PlateRectifier::Stats rectifier_stats = plate_rectifier_->getStats();
+        stats_.rectified_estimated = rectifier_stats.estimated;
+        stats_.rectified_cached = rectifier_stats.cached;
+        stats_.rectified_passthrough = rectifier_stats.passthrough;
+    }
+    
+    if (plate_voter_) {
+        PlateVoter::Stats voter_stats = plate_voter_->getStats();
+        stats_.voting_tracks = voter_stats.tracks;
+        stats_.voting_emitted = voter_stats.emitted;
+        stats_.voting_expired = voter_stats.expired;
+        stats_.voting_skipped = voter_stats.skipped;
+    }
+    
+    if (plate_prefilter_) {
+        PlatePrefilter::Stats prefilter_stats = plate_prefilter_->getStats();
+        stats_.prefilter_rejected_size = prefilter_stats.rejected_size;
+        stats_.prefilter_rejected_aspect = prefilter_stats.rejected_aspect;
+        stats_.prefilter_rejected_edge = prefilter_stats.rejected_edge;
+        stats_.prefilter_rejected_color = prefilter_stats.rejected_color;
+    }
 }
 
 void LPRSystem::displayFrame(const cv::Mat& frame, const std::vector<DetectionResult>& results) {
@@ -472,6 +1034,19 @@ void LPRSystem::displayFrame(const cv::Mat& frame, const std::vector<DetectionRe
             continue;
         }
         
+        // Vehículo de la cascada (si existe)
+        if (result.vehicle_bbox.area() > 0) {
+            double scale = (display_scale_ > 0) ? display_scale_ : 1.0;
+            cv::Rect vehicle(
+                static_cast<int>(result.vehicle_bbox.x * scale),
+                static_cast<int>(result.vehicle_bbox.y * scale),
+                static_cast<int>(result.vehicle_bbox.width * scale),
+                static_cast<int>(result.vehicle_bbox.height * scale)
+            );
+            cv::rectangle(display_frame, vehicle & cv::Rect(0, 0, display_frame.cols, display_frame.rows),
+                          cv::Scalar(255, 128, 0), 1);
+        }
+        
         // Color según si está autorizada
         cv::Scalar color = result.authorized ? cv::Scalar(0, 255, 0) : cv::Scalar(0, 0, 255);
         
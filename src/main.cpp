@@ -13,6 +13,7 @@ using namespace jetson_lpr;
 
 // Variable global para manejar señales
 static std::unique_ptr<LPRSystem> g_lpr_system = nullptr;
+static volatile std::sig_atomic_t g_reload_requested = 0;
 
 void signalHandler(int /*signal*/) {
     std::cout << "\n🛑 Señal recibida, deteniendo sistema..." << std::endl;
@@ -22,6 +23,48 @@ void signalHandler(int /*signal*/) {
     exit(0);
 }
 
+void reloadSignalHandler(int /*signal*/) {
+    // Solo marcar: la recarga se atiende desde el bucle principal
+    g_reload_requested = 1;
+}
+
+void printStrategyStats(const OCRStrategyStats::Summary& summary) {
+    std::cout << "   Estrategias OCR ganadoras:";
+    for (size_t i = 0; i < summary.wins.size() && i < summary.names.size(); ++i) {
+        if (summary.wins[i] > 0) {
+            std::cout << " " << summary.names[i] << "=" << summary.wins[i];
+        }
+    }
+    std::cout << " | intentos/placa: " << std::fixed << std::setprecision(1)
+              << summary.average_attempts << std::endl;
+}
+
+void printCacheStats(const OCRResultCache::Stats& cache) {
+    std::cout << "   Cache OCR: " << cache.hits << " aciertos, " << cache.misses << " fallos ("
+              << std::fixed << std::setprecision(1) << 100.0 * cache.hit_rate << "%), "
+              << cache.evictions << " desalojos, " << cache.expirations << " vencidas, "
+              << cache.entries << "/" << cache.capacity << " entradas" << std::endl;
+}
+
+void printRectificationStats(const LPRSystem::Stats& stats) {
+    uint64_t total = stats.rectified_estimated + stats.rectified_cached + stats.rectified_passthrough;
+    if (total == 0) {
+        return;
+    }
+    std::cout << "   Rectificación: " << stats.rectified_estimated << " estimadas, "
+              << stats.rectified_cached << " con geometría del carril, "
+              << stats.rectified_passthrough << " sin rectificar" << std::endl;
+}
+
+void printVotingStats(const LPRSystem::Stats& stats) {
+    if (stats.voting_tracks == 0) {
+        return;
+    }
+    std::cout << "   Votación: " << stats.voting_tracks << " vehículos, " << stats.voting_emitted
+              << " placas por consenso, " << stats.voting_expired << " por mayoría al expirar, "
+              << stats.voting_skipped << " lecturas de OCR evitadas" << std::endl;
+}
+
 void printUsage(const char* program_name) {
     std::cout << "Uso: " << program_name << " [OPCIONES]\n"
               << "\n"
@@ -32,6 +75,9 @@ void printUsage(const char* program_name) {
               << "  --cooldown COOLDOWN         Cooldown en segundos (default: 0.5)\n"
               << "  --confidence CONFIDENCE     Umbral confianza detección (default: 0.30)\n"
               << "  --headless                  Modo sin GUI (recomendado para Jetson)\n"
+              << "\n"
+              << "SEÑALES:\n"
+              << "  SIGUSR1                     Recargar el modelo del detector sin reiniciar\n"
               << std::endl;
 }
 
@@ -43,6 +89,7 @@ int main(int argc, char* argv[]) {
     // Registrar manejador de señales
     std::signal(SIGINT, signalHandler);
     std::signal(SIGTERM, signalHandler);
+    std::signal(SIGUSR1, reloadSignalHandler);
     
     // Parsear argumentos de línea de comandos
     std::string config_path = "config/default_config.json";
@@ -96,8 +143,21 @@ int main(int argc, char* argv[]) {
     // Bucle principal
     std::cout << "\n📊 Sistema LPR en ejecución. Presiona Ctrl+C para detener.\n" << std::endl;
     
+    auto last_stats = std::chrono::steady_clock::now();
+    
     while (g_lpr_system->isRunning()) {
-        std::this_thread::sleep_for(std::chrono::seconds(5));
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        
+        if (g_reload_requested) {
+            g_reload_requested = 0;
+            std::cout << "🔄 Recarga de modelo solicitada (SIGUSR1)" << std::endl;
+            g_lpr_system->requestModelReload();
+        }
+        
+        if (std::chrono::steady_clock::now() - last_stats < std::chrono::seconds(5)) {
+            continue;
+        }
+        last_stats = std::chrono::steady_clock::now();
         
         // Mostrar estadísticas cada 5 segundos
         auto stats = g_lpr_system->getStats();
@@ -108,6 +168,13 @@ int main(int argc, char* argv[]) {
         std::cout << "   Detecciones: " << stats.detections_count << std::endl;
         std::cout << "   FPS captura: " << std::fixed << std::setprecision(1) << stats.capture_fps << std::endl;
         std::cout << "   FPS IA: " << std::fixed << std::setprecision(1) << stats.ai_fps << std::endl;
+        std::cout << "   Descartes prefiltro (tamaño/aspecto/borde/color): "
+                  << stats.prefilter_rejected_size << "/" << stats.prefilter_rejected_aspect << "/"
+                  << stats.prefilter_rejected_edge << "/" << stats.prefilter_rejected_color << std::endl;
+        printStrategyStats(stats.ocr_strategies);
+        printCacheStats(stats.ocr_cache);
+        printRectificationStats(stats);
+        printVotingStats(stats);
         std::cout << std::endl;
     }
     
@@ -122,6 +189,15 @@ int main(int argc, char* argv[]) {
     std::cout << "   Detecciones totales: " << final_stats.detections_count << std::endl;
     std::cout << "   FPS promedio captura: " << std::fixed << std::setprecision(1) << final_stats.capture_fps << std::endl;
     std::cout << "   FPS promedio IA: " << std::fixed << std::setprecision(1) << final_stats.ai_fps << std::endl;
+    printStrategyStats(final_stats.ocr_strategies);
+    printCacheStats(final_stats.ocr_cache);
+    printRectificationStats(final_stats);
+    printVotingStats(final_stats);
+    std::cout << "   Primera decisión: " << std::fixed << std::setprecision(0)
+              << final_stats.time_to_first_decision_ms << " ms desde el lanzamiento" << std::endl;
+    std::cout << "   Descartes prefiltro (tamaño/aspecto/borde/color): "
+              << final_stats.prefilter_rejected_size << "/" << final_stats.prefilter_rejected_aspect << "/"
+              << final_stats.prefilter_rejected_edge << "/" << final_stats.prefilter_rejected_color << std::endl;
     
     std::cout << "\n✅ Sistema LPR finalizado correctamente" << std::endl;
     
@@ -0,0 +1,151 @@
+#include "model_reloader.h"
+#include <iostream>
+#include <filesystem>
+#include <algorithm>
+
+namespace jetson_lpr {
+
+namespace fs = std::filesystem;
+
+ModelReloader::ModelReloader(PlateDetector& detector, bool watch_file, double poll_interval_sec)
+    : detector_(detector)
+    , watch_file_(watch_file)
+    , poll_interval_(static_cast<int64_t>(std::max(0.1, poll_interval_sec) * 1000.0))
+    , running_(false)
+    , reload_requested_(false)
+    , last_mtime_(0)
+    , pending_size_(-1)
+    , reloads_ok_(0)
+    , reloads_failed_(0)
+{
+}
+
+ModelReloader::~ModelReloader() {
+    stop();
+}
+
+void ModelReloader::start() {
+    if (running_) {
+        return;
+    }
+
+    snapshotModelFile();
+    running_ = true;
+    worker_ = std::thread(&ModelReloader::reloadWorker, this);
+
+    std::cout << "🔄 Recarga de modelo habilitada (SIGUSR1"
+              << (watch_file_ ? ", vigilando " + watched_path_ : std::string()) << ")" << std::endl;
+}
+
+void ModelReloader::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cv_.notify_all();
+
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void ModelReloader::requestReload(const std::string& model_path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reload_requested_ = true;
+        requested_path_ = model_path;
+    }
+    cv_.notify_one();
+}
+
+void ModelReloader::snapshotModelFile() {
+    watched_path_ = detector_.getModelPath();
+    pending_size_ = -1;
+
+    std::error_code ec;
+    auto mtime = fs::last_write_time(watched_path_, ec);
+    last_mtime_ = ec ? 0 : static_cast<int64_t>(mtime.time_since_epoch().count());
+}
+
+bool ModelReloader::checkModelFile() {
+    if (detector_.getModelPath() != watched_path_) {
+        snapshotModelFile();
+        return false;
+    }
+
+    std::error_code ec;
+    auto mtime = fs::last_write_time(watched_path_, ec);
+    if (ec) {
+        // Archivo reemplazado a medias (rename en curso) o eliminado
+        return false;
+    }
+    int64_t size = static_cast<int64_t>(fs::file_size(watched_path_, ec));
+    if (ec) {
+        return false;
+    }
+
+    if (static_cast<int64_t>(mtime.time_since_epoch().count()) == last_mtime_) {
+        pending_size_ = -1;
+        return false;
+    }
+
+    // Cambió: esperar un sondeo más con el mismo tamaño (copia terminada)
+    if (size != pending_size_) {
+        pending_size_ = size;
+        return false;
+    }
+
+    return true;
+}
+
+void ModelReloader::reloadWorker() {
+    while (running_) {
+        std::string path;
+        bool requested = false;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait_for(lock, poll_interval_, [this]() {
+                return !running_ || reload_requested_;
+            });
+
+            if (!running_) {
+                break;
+            }
+
+            if (reload_requested_) {
+                requested = true;
+                path = requested_path_;
+                reload_requested_ = false;
+                requested_path_.clear();
+            }
+        }
+
+        if (!requested && watch_file_ && checkModelFile()) {
+            std::cout << "📁 Cambio detectado en " << watched_path_ << std::endl;
+            requested = true;
+        }
+
+        if (!requested) {
+            continue;
+        }
+
+        if (path.empty()) {
+            path = detector_.getModelPath();
+        }
+
+        if (detector_.reloadModel(path)) {
+            reloads_ok_++;
+        } else {
+            reloads_failed_++;
+        }
+
+        // Un archivo fallido no se reintenta hasta que vuelva a cambiar
+        snapshotModelFile();
+    }
+}
+
+} // namespace jetson_lpr
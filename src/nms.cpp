@@ -0,0 +1,240 @@
+#include "nms.h"
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LPR_NMS_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define LPR_NMS_NEON 1
+#endif
+
+namespace jetson_lpr {
+
+FastNMS::FastNMS(const NMSConfig& config)
+    : config_(config)
+{
+}
+
+void FastNMS::reserve(size_t max_candidates) {
+    order_.reserve(max_candidates);
+    keep_.reserve(max_candidates);
+    sx1_.reserve(max_candidates);
+    sy1_.reserve(max_candidates);
+    sx2_.reserve(max_candidates);
+    sy2_.reserve(max_candidates);
+    sarea_.reserve(max_candidates);
+    sscore_.reserve(max_candidates);
+    sclass_.reserve(max_candidates);
+    iou_.reserve(max_candidates);
+    suppressed_.reserve(max_candidates);
+}
+
+const std::vector<int>& FastNMS::run(CandidateBuffer& candidates) {
+    keep_.clear();
+
+    const int n = static_cast<int>(candidates.size());
+    if (n == 0) {
+        return keep_;
+    }
+
+    // Ordenar índices por score (solo los top-K necesitan orden total)
+    order_.resize(n);
+    std::iota(order_.begin(), order_.end(), 0);
+
+    const float* scores = candidates.scores.data();
+    auto by_score = [scores](int a, int b) {
+        if (scores[a] != scores[b]) {
+            return scores[a] > scores[b];
+        }
+        return a < b;  // Desempate determinista
+    };
+
+    int count = n;
+    if (config_.top_k > 0 && config_.top_k < n) {
+        count = config_.top_k;
+        std::partial_sort(order_.begin(), order_.begin() + count, order_.end(), by_score);
+    } else {
+        std::sort(order_.begin(), order_.end(), by_score);
+    }
+
+    // Copiar los top-K a buffers compactos contiguos
+    sx1_.resize(count);
+    sy1_.resize(count);
+    sx2_.resize(count);
+    sy2_.resize(count);
+    sarea_.resize(count);
+    sscore_.resize(count);
+    sclass_.resize(count);
+    iou_.resize(count);
+    suppressed_.assign(count, 0);
+
+    for (int i = 0; i < count; ++i) {
+        const int idx = order_[i];
+        sx1_[i] = candidates.x1[idx];
+        sy1_[i] = candidates.y1[idx];
+        sx2_[i] = candidates.x2[idx];
+        sy2_[i] = candidates.y2[idx];
+        sarea_[i] = std::max(0.0f, sx2_[i] - sx1_[i]) * std::max(0.0f, sy2_[i] - sy1_[i]);
+        sscore_[i] = candidates.scores[idx];
+        sclass_[i] = candidates.class_ids[idx];
+    }
+
+    if (config_.soft_nms) {
+        runSoft(count, candidates);
+    } else {
+        runHard(count);
+    }
+
+    return keep_;
+}
+
+void FastNMS::runHard(int count) {
+    const size_t max_keep = config_.max_detections > 0
+        ? static_cast<size_t>(config_.max_detections)
+        : static_cast<size_t>(count);
+
+    for (int i = 0; i < count; ++i) {
+        if (suppressed_[i]) {
+            continue;
+        }
+
+        keep_.push_back(order_[i]);
+        if (keep_.size() >= max_keep) {
+            break;
+        }
+
+        computeIoU(i, i + 1, count, iou_.data());
+
+        for (int j = i + 1; j < count; ++j) {
+            if (iou_[j] > config_.iou_threshold &&
+                (!config_.class_aware || sclass_[j] == sclass_[i])) {
+                suppressed_[j] = 1;
+            }
+        }
+    }
+}
+
+void FastNMS::runSoft(int count, CandidateBuffer& candidates) {
+    const size_t max_keep = config_.max_detections > 0
+        ? static_cast<size_t>(config_.max_detections)
+        : static_cast<size_t>(count);
+    const float inv_sigma = 1.0f / std::max(config_.soft_sigma, 1e-6f);
+
+    // suppressed_ marca candidatos ya conservados o descartados
+    while (keep_.size() < max_keep) {
+        // Buscar el score máximo entre los candidatos activos
+        int best = -1;
+        float best_score = config_.soft_min_score;
+        for (int j = 0; j < count; ++j) {
+            if (!suppressed_[j] && sscore_[j] >= best_score) {
+                if (best < 0 || sscore_[j] > best_score) {
+                    best = j;
+                    best_score = sscore_[j];
+                }
+            }
+        }
+
+        if (best < 0) {
+            break;
+        }
+
+        suppressed_[best] = 1;
+        keep_.push_back(order_[best]);
+        candidates.scores[order_[best]] = sscore_[best];
+
+        computeIoU(best, 0, count, iou_.data());
+
+        // Decaimiento gaussiano de los candidatos que solapan
+        for (int j = 0; j < count; ++j) {
+            if (suppressed_[j]) {
+                continue;
+            }
+            if (config_.class_aware && sclass_[j] != sclass_[best]) {
+                continue;
+            }
+            const float iou = iou_[j];
+            if (iou > 0.0f) {
+                sscore_[j] *= std::exp(-(iou * iou) * inv_sigma);
+            }
+            if (sscore_[j] < config_.soft_min_score) {
+                suppressed_[j] = 1;
+            }
+        }
+    }
+}
+
+void FastNMS::computeIoU(int i, int begin, int end, float* out) const {
+    const float ax1 = sx1_[i];
+    const float ay1 = sy1_[i];
+    const float ax2 = sx2_[i];
+    const float ay2 = sy2_[i];
+    const float aarea = sarea_[i];
+
+    int j = begin;
+
+#if defined(LPR_NMS_SSE2)
+    const __m128 vax1 = _mm_set1_ps(ax1);
+    const __m128 vay1 = _mm_set1_ps(ay1);
+    const __m128 vax2 = _mm_set1_ps(ax2);
+    const __m128 vay2 = _mm_set1_ps(ay2);
+    const __m128 varea = _mm_set1_ps(aarea);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 eps = _mm_set1_ps(1e-6f);
+
+    for (; j + 4 <= end; j += 4) {
+        __m128 xx1 = _mm_max_ps(vax1, _mm_loadu_ps(&sx1_[j]));
+        __m128 yy1 = _mm_max_ps(vay1, _mm_loadu_ps(&sy1_[j]));
+        __m128 xx2 = _mm_min_ps(vax2, _mm_loadu_ps(&sx2_[j]));
+        __m128 yy2 = _mm_min_ps(vay2, _mm_loadu_ps(&sy2_[j]));
+
+        __m128 w = _mm_max_ps(_mm_sub_ps(xx2, xx1), zero);
+        __m128 h = _mm_max_ps(_mm_sub_ps(yy2, yy1), zero);
+        __m128 inter = _mm_mul_ps(w, h);
+        __m128 uni = _mm_sub_ps(_mm_add_ps(varea, _mm_loadu_ps(&sarea_[j])), inter);
+
+        _mm_storeu_ps(&out[j], _mm_div_ps(inter, _mm_max_ps(uni, eps)));
+    }
+#elif defined(LPR_NMS_NEON)
+    const float32x4_t vax1 = vdupq_n_f32(ax1);
+    const float32x4_t vay1 = vdupq_n_f32(ay1);
+    const float32x4_t vax2 = vdupq_n_f32(ax2);
+    const float32x4_t vay2 = vdupq_n_f32(ay2);
+    const float32x4_t varea = vdupq_n_f32(aarea);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t eps = vdupq_n_f32(1e-6f);
+
+    for (; j + 4 <= end; j += 4) {
+        float32x4_t xx1 = vmaxq_f32(vax1, vld1q_f32(&sx1_[j]));
+        float32x4_t yy1 = vmaxq_f32(vay1, vld1q_f32(&sy1_[j]));
+        float32x4_t xx2 = vminq_f32(vax2, vld1q_f32(&sx2_[j]));
+        float32x4_t yy2 = vminq_f32(vay2, vld1q_f32(&sy2_[j]));
+
+        float32x4_t w = vmaxq_f32(vsubq_f32(xx2, xx1), zero);
+        float32x4_t h = vmaxq_f32(vsubq_f32(yy2, yy1), zero);
+        float32x4_t inter = vmulq_f32(w, h);
+        float32x4_t uni = vsubq_f32(vaddq_f32(varea, vld1q_f32(&sarea_[j])), inter);
+        uni = vmaxq_f32(uni, eps);
+
+        // División con recíproco + dos pasos de Newton-Raphson (ARMv7 no tiene vdivq)
+        float32x4_t recip = vrecpeq_f32(uni);
+        recip = vmulq_f32(vrecpsq_f32(uni, recip), recip);
+        recip = vmulq_f32(vrecpsq_f32(uni, recip), recip);
+
+        vst1q_f32(&out[j], vmulq_f32(inter, recip));
+    }
+#endif
+
+    // Resto escalar
+    for (; j < end; ++j) {
+        const float w = std::max(0.0f, std::min(ax2, sx2_[j]) - std::max(ax1, sx1_[j]));
+        const float h = std::max(0.0f, std::min(ay2, sy2_[j]) - std::max(ay1, sy1_[j]));
+        const float inter = w * h;
+        const float uni = aarea + sarea_[j] - inter;
+        out[j] = inter / std::max(uni, 1e-6f);
+    }
+}
+
+} // namespace jetson_lpr
@@ -0,0 +1,146 @@
+#include "ocr_engine_pool.h"
+#include <tesseract/baseapi.h>
+#include <iostream>
+#include <algorithm>
+#include <future>
+#include <thread>
+
+namespace jetson_lpr {
+
+OCREnginePool::Lease::Lease(Lease&& other) noexcept
+    : pool_(other.pool_)
+    , slot_(other.slot_)
+{
+    other.pool_ = nullptr;
+}
+
+OCREnginePool::Lease& OCREnginePool::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        if (pool_) {
+            pool_->release(slot_);
+        }
+        pool_ = other.pool_;
+        slot_ = other.slot_;
+        other.pool_ = nullptr;
+    }
+    return *this;
+}
+
+OCREnginePool::Lease::~Lease() {
+    if (pool_) {
+        pool_->release(slot_);
+    }
+}
+
+tesseract::TessBaseAPI& OCREnginePool::Lease::operator*() const {
+    return *pool_->engines_[slot_];
+}
+
+tesseract::TessBaseAPI* OCREnginePool::Lease::operator->() const {
+    return pool_->engines_[slot_].get();
+}
+
+OCREnginePool::OCREnginePool(size_t size)
+    : requested_size_(size)
+    , next_slot_(0)
+    , waiters_(0)
+{
+    if (requested_size_ == 0) {
+        // Cada instancia carga su propio modelo (~30-50 MB con "eng")
+        requested_size_ = std::min<size_t>(4, std::max(1u, std::thread::hardware_concurrency()));
+    }
+}
+
+OCREnginePool::~OCREnginePool() {
+    for (auto& engine : engines_) {
+        engine->End();
+    }
+}
+
+bool OCREnginePool::initialize(const EngineSetup& setup) {
+    if (!engines_.empty()) {
+        return true;
+    }
+
+    // Init() lee el traineddata del disco: en paralelo el arranque cuesta una sola carga
+    std::vector<std::future<std::unique_ptr<tesseract::TessBaseAPI>>> pending;
+    for (size_t i = 0; i < requested_size_; ++i) {
+        pending.push_back(std::async(std::launch::async, [&setup]() {
+            auto engine = std::make_unique<tesseract::TessBaseAPI>();
+            if (!setup(*engine)) {
+                engine.reset();
+            }
+            return engine;
+        }));
+    }
+
+    for (auto& future : pending) {
+        std::unique_ptr<tesseract::TessBaseAPI> engine = future.get();
+        if (engine) {
+            engines_.push_back(std::move(engine));
+        }
+    }
+
+    if (engines_.size() < requested_size_) {
+        std::cerr << "⚠️ Solo " << engines_.size() << " de " << requested_size_
+                  << " instancias de Tesseract se inicializaron" << std::endl;
+    }
+
+    busy_.reset(new std::atomic<bool>[engines_.size()]);
+    for (size_t i = 0; i < engines_.size(); ++i) {
+        busy_[i] = false;
+    }
+
+    return !engines_.empty();
+}
+
+OCREnginePool::Lease OCREnginePool::tryLease() {
+    const size_t count = engines_.size();
+    if (count == 0) {
+        return Lease();
+    }
+
+    const size_t start = next_slot_.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i) {
+        size_t slot = (start + i) % count;
+        bool expected = false;
+        if (busy_[slot].compare_exchange_strong(expected, true)) {
+            return Lease(this, slot);
+        }
+    }
+    return Lease();
+}
+
+OCREnginePool::Lease OCREnginePool::lease() {
+    if (engines_.empty()) {
+        return Lease();
+    }
+
+    Lease lease = tryLease();
+    if (lease) {
+        return lease;
+    }
+
+    // Pool agotado: esperar una devolución
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    waiters_++;
+    available_.wait(lock, [this, &lease]() {
+        lease = tryLease();
+        return static_cast<bool>(lease);
+    });
+    waiters_--;
+    return lease;
+}
+
+void OCREnginePool::release(size_t slot) {
+    // seq_cst: la liberación y la lectura de waiters_ no se reordenan
+    busy_[slot].store(false);
+
+    if (waiters_.load() > 0) {
+        // Tomar el mutex evita perder la notificación entre el predicado y wait()
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        available_.notify_one();
+    }
+}
+
+} // namespace jetson_lpr
@@ -1,27 +1,43 @@
 #include "ocr_processor.h"
+#include "plate_validator.h"
+#include "plate_layout_decoder.h"
 #include <tesseract/baseapi.h>
+#include <tesseract/ocrclass.h>
+#include <tesseract/resultiterator.h>
 #include <leptonica/allheaders.h>
 #include <iostream>
-#include <sstream>
 #include <iomanip>
 #include <functional>
+#include <future>
+#include <atomic>
 
 namespace jetson_lpr {
 
-OCRProcessor::OCRProcessor(const std::string& language, const std::string& data_path)
+OCRProcessor::OCRProcessor(const std::string& language, const std::string& data_path,
+                           size_t num_engines)
     : language_(language)
     , data_path_(data_path)
     , confidence_threshold_(0.2f)
-    , tesseract_api_(nullptr)
+    , target_confidence_(0.9f)
+    , valid_confidence_(0.6f)
+    , layout_substitution_confidence_(0.4f)
+    , deterministic_(false)
+    , preselect_top_(0)
+    , engines_(num_engines)
+    , recognizer_()
+    , fast_path_()
+    , fast_accept_confidence_(0.8f)
     , initialized_(false)
-    , max_cache_size_(100)
+    , strategy_stats_(strategyNames())
+    , scorer_()
+    , text_band_enabled_(false)
+    , text_band_()
+    , cache_()
 {
 }
 
 OCRProcessor::~OCRProcessor() {
-    if (tesseract_api_) {
-        tesseract_api_->End();
-    }
+    // El pool libera las instancias de Tesseract
 }
 
 bool OCRProcessor::initialize() {
@@ -29,34 +45,66 @@ bool OCRProcessor::initialize() {
         return true;
     }
     
-    try {
-        tesseract_api_ = std::make_unique<tesseract::TessBaseAPI>();
-        
-        // Inicializar Tesseract
-        int init_result = 0;
-        if (!data_path_.empty()) {
-            init_result = tesseract_api_->Init(data_path_.c_str(), language_.c_str());
-        } else {
-            init_result = tesseract_api_->Init(nullptr, language_.c_str());
+    // Ruta rápida opcional: si no arranca, todo va al OCR
+    if (fast_path_ && !fast_path_->initialize()) {
+        std::cerr << "⚠️  Ruta rápida " << fast_path_->name() << " no disponible" << std::endl;
+        fast_path_.reset();
+    }
+    
+    // Reconocedor configurado: Tesseract no hace falta
+    if (recognizer_) {
+        if (recognizer_->initialize()) {
+            initialized_ = true;
+            std::cout << "✅ OCR Processor inicializado (motor: " << recognizer_->name() << ")" << std::endl;
+            return true;
         }
+        std::cerr << "⚠️  Reconocedor " << recognizer_->name()
+                  << " no disponible, usando Tesseract" << std::endl;
+        recognizer_.reset();
+    }
+    
+    try {
+        bool ready = engines_.initialize([this](tesseract::TessBaseAPI& api) {
+            // Inicializar Tesseract
+            int init_result = 0;
+            if (!data_path_.empty()) {
+                init_result = api.Init(data_path_.c_str(), language_.c_str());
+            } else {
+                init_result = api.Init(nullptr, language_.c_str());
+            }
+            
+            if (init_result != 0) {
+                std::cerr << "Error: No se pudo inicializar Tesseract OCR" << std::endl;
+                std::cerr << "Error code: " << init_result << std::endl;
+                return false;
+            }
+            
+            // Configurar parámetros para placas colombianas
+            api.SetPageSegMode(tesseract::PSM_SINGLE_LINE);  // Una línea de texto
+            api.SetVariable("tessedit_char_whitelist", 
+                           "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789");  // Solo letras y números
+            
+            // Configuraciones adicionales para mejor reconocimiento
+            api.SetVariable("classify_bln_numeric_mode", "0");
+            api.SetVariable("textord_min_linesize", "2.5");
+            
+            // Alternativas por carácter del LSTM (ChoiceIterator)
+            api.SetVariable("lstm_choice_mode", "2");
+            
+            // Calentamiento: la primera lectura reserva los buffers internos
+            cv::Mat blank(32, 96, CV_8UC1, cv::Scalar(255));
+            api.SetImage(blank.data, blank.cols, blank.rows, 1, static_cast<int>(blank.step));
+            delete[] api.GetUTF8Text();
+            return true;
+        });
         
-        if (init_result != 0) {
-            std::cerr << "Error: No se pudo inicializar Tesseract OCR" << std::endl;
-            std::cerr << "Error code: " << init_result << std::endl;
+        if (!ready) {
             return false;
         }
         
-        // Configurar parámetros para placas colombianas
-        tesseract_api_->SetPageSegMode(tesseract::PSM_SINGLE_LINE);  // Una línea de texto
-        tesseract_api_->SetVariable("tessedit_char_whitelist", 
-                                   "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789");  // Solo letras y números
-        
-        // Configuraciones adicionales para mejor reconocimiento
-        tesseract_api_->SetVariable("classify_bln_numeric_mode", "0");
-        tesseract_api_->SetVariable("textord_min_linesize", "2.5");
-        
         initialized_ = true;
-        std::cout << "✅ OCR Processor inicializado (idioma: " << language_ << ")" << std::endl;
+        std::cout << "✅ OCR Processor inicializado (idioma: " << language_
+                  << ", instancias: " << engines_.size() << ")" << std::endl;
         
         return true;
         
@@ -71,92 +119,362 @@ OCRResult OCRProcessor::recognize(const cv::Mat& plate_image, bool use_cache) {
         return OCRResult();
     }
     
+    if (recognizer_) {
+        return recognizeBatch({plate_image}, use_cache).front();
+    }
+    
     // Verificar cache
+    uint64_t image_hash = 0;
     if (use_cache) {
-        std::string image_hash = calculateImageHash(plate_image);
+        image_hash = OCRResultCache::perceptualHash(plate_image);
         
-        std::lock_guard<std::mutex> lock(cache_mutex_);
-        auto it = ocr_cache_.find(image_hash);
-        if (it != ocr_cache_.end()) {
-            return it->second;
+        OCRResult cached;
+        if (cache_.lookup(image_hash, cached)) {
+            cached.attempts = 0;
+            return cached;
         }
     }
     
-    // Preprocesar imagen
-    cv::Mat processed = preprocessPlateImage(plate_image);
+    // Preprocesar imagen (solo la banda de los caracteres)
+    cv::Mat processed = preprocessPlateImage(
+        text_band_enabled_ ? plate_image(text_band_.locate(plate_image)) : plate_image);
     
     // Reconocer texto
-    OCRResult result = recognizeInternal(processed);
+    OCRResult result = recognizeInternal(*engines_.lease(), processed);
+    result.attempts = 1;
     
-    // Guardar en cache
-    if (use_cache && !result.text.empty()) {
-        std::string image_hash = calculateImageHash(plate_image);
-        
-        std::lock_guard<std::mutex> lock(cache_mutex_);
-        
-        // Limpiar cache si está muy lleno
-        if (ocr_cache_.size() >= max_cache_size_) {
-            // Eliminar 20% más antiguos
-            size_t to_remove = max_cache_size_ / 5;
-            auto it = ocr_cache_.begin();
-            for (size_t i = 0; i < to_remove && it != ocr_cache_.end(); ++i) {
-                it = ocr_cache_.erase(it);
-            }
-        }
-        
-        ocr_cache_[image_hash] = result;
+    // Guardar en cache (solo lecturas confiables, como en recognizeMultipleAttempts)
+    if (use_cache && isGoodEnough(result)) {
+        cache_.insert(image_hash, result);
     }
     
     return result;
 }
 
-OCRResult OCRProcessor::recognizeMultipleAttempts(const cv::Mat& plate_image) {
+OCRResult OCRProcessor::recognizeMultipleAttempts(const cv::Mat& plate_image, bool use_cache) {
     if (!initialized_ || plate_image.empty()) {
         return OCRResult();
     }
     
+    if (recognizer_) {
+        return recognizeBatch({plate_image}, use_cache).front();
+    }
+    
+    // La misma placa en el frame anterior: sin Tesseract
+    uint64_t image_hash = 0;
+    if (use_cache) {
+        image_hash = OCRResultCache::perceptualHash(plate_image);
+        
+        OCRResult cached;
+        if (cache_.lookup(image_hash, cached)) {
+            cached.attempts = 0;
+            return cached;
+        }
+    }
+    
     OCRResult best_result;
-    float best_confidence = 0.0f;
+    if (!recognizeFast(plate_image, best_result)) {
+        best_result = recognizeWithTesseract(plate_image);
+    }
+    
+    // Solo lecturas que habrían detenido los intentos: una mala lectura
+    // cacheada taparía la del frame siguiente, que puede ser más nítido
+    if (use_cache && isGoodEnough(best_result)) {
+        cache_.insert(image_hash, best_result);
+    }
+    
+    return best_result;
+}
+
+std::vector<OCRResult> OCRProcessor::recognizeBatch(const std::vector<cv::Mat>& plates, bool use_cache) {
+    std::vector<OCRResult> results(plates.size());
+    if (!initialized_) {
+        return results;
+    }
+    
+    if (!recognizer_) {
+        for (size_t i = 0; i < plates.size(); ++i) {
+            results[i] = recognizeMultipleAttempts(plates[i], use_cache);
+        }
+        return results;
+    }
+    
+    // Placas ya leídas en frames anteriores: del cache; el resto, en un lote
+    std::vector<uint64_t> hashes(plates.size(), 0);
+    std::vector<cv::Mat> pending;
+    std::vector<size_t> pending_index;
+    for (size_t i = 0; i < plates.size(); ++i) {
+        if (plates[i].empty()) {
+            continue;
+        }
+        if (use_cache) {
+            hashes[i] = OCRResultCache::perceptualHash(plates[i]);
+            if (cache_.lookup(hashes[i], results[i])) {
+                results[i].attempts = 0;
+                continue;
+            }
+        }
+        if (recognizeFast(plates[i], results[i])) {
+            if (use_cache && isGoodEnough(results[i])) {
+                cache_.insert(hashes[i], results[i]);
+            }
+            continue;
+        }
+        pending.push_back(plates[i]);
+        pending_index.push_back(i);
+    }
+    
+    if (pending.empty()) {
+        return results;
+    }
+    
+    std::vector<OCRResult> recognized = recognizer_->recognizeBatch(pending);
+    for (size_t j = 0; j < pending_index.size() && j < recognized.size(); ++j) {
+        OCRResult& result = recognized[j];
+        
+        // Filtrar por confianza mínima, igual que las lecturas de Tesseract
+        if (result.confidence < confidence_threshold_) {
+            int attempts = result.attempts;
+            result = OCRResult();
+            result.attempts = attempts;
+        }
+        
+        size_t i = pending_index[j];
+        if (use_cache && isGoodEnough(result)) {
+            cache_.insert(hashes[i], result);
+        }
+        results[i] = std::move(result);
+    }
+    
+    return results;
+}
+
+bool OCRProcessor::recognizeFast(const cv::Mat& plate_image, OCRResult& result) {
+    if (!fast_path_) {
+        return false;
+    }
+    
+    OCRResult fast = fast_path_->recognizeBatch({plate_image}).front();
+    if (fast.confidence < fast_accept_confidence_ || !isValidPlate(fast)) {
+        return false;
+    }
+    
+    fast.attempts = 0;
+    result = std::move(fast);
+    return true;
+}
+
+OCRResult OCRProcessor::recognizeWithTesseract(const cv::Mat& plate_image) {
+    int attempts = 0;
     
     // Convertir a escala de grises si es necesario
     cv::Mat gray;
     if (plate_image.channels() == 3) {
         cv::cvtColor(plate_image, gray, cv::COLOR_BGR2GRAY);
     } else {
-        gray = plate_image.clone();
+        gray = plate_image;
+    }
+    
+    // Sin marco ni ciudad: una línea más angosta para Tesseract
+    if (text_band_enabled_) {
+        gray = gray(text_band_.locate(gray));
+    }
+    
+    // Todas las binarizaciones de una vez, en planos reutilizados por hilo
+    thread_local ThresholdBank bank;
+    bank.compute(gray);
+    
+    // Orden de las binarizaciones: el que más gana en esta cámara y franja
+    // horaria primero (orden fijo en modo determinista)
+    std::vector<int> order;
+    if (deterministic_) {
+        for (int i = 0; i < THRESHOLD_STRATEGY_COUNT; ++i) {
+            order.push_back(i);
+        }
+    } else {
+        for (int strategy : strategy_stats_.order()) {
+            if (strategy < THRESHOLD_STRATEGY_COUNT) {
+                order.push_back(strategy);
+            }
+        }
+    }
+    
+    // Tesseract solo sobre las que mejor separan los caracteres
+    if (preselect_top_ > 0) {
+        order = preselectStrategies(bank, order);
+    }
+    
+    OCRResult best_result = (deterministic_ || engines_.size() < 2)
+        ? recognizeSequential(bank, order, attempts)
+        : recognizeParallel(bank, order, attempts);
+    
+    // Si ningún resultado es bueno, intentar con la imagen original preprocesada:
+    // primero la banda y, si tampoco basta, el recorte completo (la banda
+    // puede haber cortado caracteres)
+    std::vector<cv::Mat> fallbacks;
+    if (text_band_enabled_) {
+        fallbacks.push_back(gray);
+    }
+    fallbacks.push_back(plate_image);
+    for (const cv::Mat& image : fallbacks) {
+        if (best_result.confidence >= 0.5f) {
+            break;
+        }
+        OCRResult result = recognizeInternal(*engines_.lease(), preprocessPlateImage(image));
+        result.strategy = FALLBACK_STRATEGY;
+        attempts++;
+        
+        if (isBetter(result, best_result)) {
+            best_result = result;
+        }
+    }
+    
+    best_result.attempts = attempts;
+    strategy_stats_.record(best_result.text.empty() ? -1 : best_result.strategy, attempts);
+    
+    return best_result;
+}
+
+std::vector<int> OCRProcessor::preselectStrategies(const ThresholdBank& bank, const std::vector<int>& order) const {
+    std::vector<bool> candidate(THRESHOLD_STRATEGY_COUNT, false);
+    for (int strategy : order) {
+        candidate[strategy] = true;
+    }
+    
+    // Un umbral y su inverso puntúan igual (el puntaje prueba las dos
+    // polaridades): se puntúa el nivel una vez y solo queda la variante
+    // con caracteres oscuros sobre fondo claro
+    std::vector<float> scores(THRESHOLD_STRATEGY_COUNT, -1.0f);
+    std::vector<cv::Rect> characters;
+    for (int strategy : order) {
+        const int inverse = ThresholdBank::inverseOf(strategy);
+        if (inverse < 0 || !candidate[inverse]) {
+            scores[strategy] = scorer_.score(bank.plane(strategy)).score;
+            continue;
+        }
+        if (inverse < strategy) {
+            continue;   // Par ya puntuado desde la variante directa
+        }
+        bool dark_text = true;
+        const float score = scorer_.segment(bank.plane(strategy), characters, dark_text).score;
+        scores[dark_text ? strategy : inverse] = score;
+    }
+    
+    std::vector<int> selected;
+    for (int strategy : order) {
+        if (scores[strategy] >= 0.0f) {
+            selected.push_back(strategy);
+        }
+    }
+    std::stable_sort(selected.begin(), selected.end(), [&scores](int a, int b) {
+        return scores[a] > scores[b];
+    });
+    if (selected.size() > static_cast<size_t>(preselect_top_)) {
+        selected.resize(preselect_top_);
+    }
+    return selected;
+}
+
+bool OCRProcessor::isValidPlate(const OCRResult& result) {
+    return !result.text.empty() &&
+           PlateValidator::isValidColombianFormat(PlateValidator::normalizeColombianPlate(result.text));
+}
+
+bool OCRProcessor::isBetter(const OCRResult& candidate, const OCRResult& best) {
+    // Un texto con formato de placa gana a uno sin formato aunque tenga menos confianza
+    bool candidate_valid = isValidPlate(candidate);
+    bool best_valid = isValidPlate(best);
+    if (candidate_valid != best_valid) {
+        return candidate_valid;
     }
+    return candidate.confidence > best.confidence;
+}
+
+bool OCRProcessor::isGoodEnough(const OCRResult& result) const {
+    return result.confidence > target_confidence_ ||
+           (result.confidence >= valid_confidence_ && isValidPlate(result));
+}
+
+OCRResult OCRProcessor::recognizeSequential(const ThresholdBank& bank, const std::vector<int>& order, int& attempts) {
+    OCRResult best_result;
     
-    // Intentar múltiples técnicas de binarización
-    std::vector<cv::Mat> binary_images = applyMultipleThresholds(gray);
+    // Una instancia para todos los intentos de esta placa
+    OCREnginePool::Lease engine = engines_.lease();
     
-    // Probar cada imagen binarizada
-    for (const auto& binary_img : binary_images) {
-        OCRResult result = recognizeInternal(binary_img);
+    // Probar cada binarización en orden
+    for (int strategy : order) {
+        OCRResult result = recognizeInternal(*engine, bank.plane(strategy));
+        result.strategy = strategy;
+        attempts++;
         
-        if (result.confidence > best_confidence) {
-            best_confidence = result.confidence;
+        if (isBetter(result, best_result)) {
             best_result = result;
         }
         
-        // Si encontramos una confianza muy alta, usar este resultado
-        if (best_confidence > 0.9f) {
+        // Confianza muy alta, o placa válida con confianza suficiente
+        if (isGoodEnough(best_result)) {
             break;
         }
     }
     
-    // Si ningún resultado es bueno, intentar con la imagen original preprocesada
-    if (best_confidence < 0.5f) {
-        cv::Mat processed = preprocessPlateImage(plate_image);
-        OCRResult result = recognizeInternal(processed);
+    return best_result;
+}
+
+OCRResult OCRProcessor::recognizeParallel(const ThresholdBank& bank, const std::vector<int>& order, int& attempts) {
+    std::atomic<size_t> next_attempt(0);
+    std::atomic<int> started(0);
+    std::atomic<bool> cancel(false);
+    std::vector<OCRResult> results(order.size());
+    
+    // Cada hilo lee la siguiente estrategia; Tesseract consulta `cancel`
+    // entre palabras y aborta en cuanto otra alcanza el objetivo
+    auto worker = [this, &bank, &order, &results, &next_attempt, &started, &cancel](OCREnginePool::Lease engine) {
+        tesseract::ETEXT_DESC monitor;
+        monitor.cancel = &OCRProcessor::isCancelled;
+        monitor.cancel_this = &cancel;
         
-        if (result.confidence > best_confidence) {
-            best_result = result;
+        size_t index;
+        while (!cancel && (index = next_attempt++) < order.size()) {
+            started++;
+            results[index] = recognizeInternal(*engine, bank.plane(order[index]), &monitor);
+            results[index].strategy = order[index];
+            if (isGoodEnough(results[index])) {
+                cancel = true;
+            }
         }
+    };
+    
+    // Instancias libres ahora; si otras placas ocupan el pool se usan menos hilos
+    std::vector<std::future<void>> helpers;
+    size_t workers = std::min(engines_.size(), order.size());
+    for (size_t i = 1; i < workers; ++i) {
+        OCREnginePool::Lease engine = engines_.tryLease();
+        if (!engine) {
+            break;
+        }
+        helpers.push_back(std::async(std::launch::async, worker, std::move(engine)));
     }
+    worker(engines_.lease());
+    for (auto& helper : helpers) {
+        helper.get();
+    }
+    
+    attempts += started;
     
+    // En empate gana la estrategia que va antes en el orden
+    OCRResult best_result;
+    for (const OCRResult& result : results) {
+        if (isBetter(result, best_result)) {
+            best_result = result;
+        }
+    }
     return best_result;
 }
 
+bool OCRProcessor::isCancelled(void* cancel_flag, int /*words*/) {
+    return static_cast<std::atomic<bool>*>(cancel_flag)->load();
+}
+
 cv::Mat OCRProcessor::preprocessPlateImage(const cv::Mat& image) {
     cv::Mat processed;
     
@@ -200,42 +518,40 @@ cv::Mat OCRProcessor::preprocessPlateImage(const cv::Mat& image) {
 }
 
 void OCRProcessor::clearCache() {
-    std::lock_guard<std::mutex> lock(cache_mutex_);
-    ocr_cache_.clear();
+    cache_.clear();
 }
 
-std::string OCRProcessor::calculateImageHash(const cv::Mat& image) {
-    // Hash simple basado en tamaño y algunos píxeles
-    std::ostringstream oss;
-    oss << image.rows << "x" << image.cols << "_";
-    
-    // Muestrear algunos píxeles
-    int sample_size = std::min(20, image.rows * image.cols / 100);
-    for (int i = 0; i < sample_size; ++i) {
-        int x = (i * 17) % image.cols;
-        int y = (i * 23) % image.rows;
-        oss << std::hex << static_cast<int>(image.at<uchar>(y, x)) << "_";
-    }
-    
-    return oss.str();
-}
-
-OCRResult OCRProcessor::recognizeInternal(const cv::Mat& processed_image) {
-    if (!tesseract_api_ || processed_image.empty()) {
+OCRResult OCRProcessor::recognizeInternal(tesseract::TessBaseAPI& engine,
+                                          const cv::Mat& processed_image,
+                                          tesseract::ETEXT_DESC* monitor) {
+    if (processed_image.empty()) {
         return OCRResult();
     }
     
     try {
         // Configurar imagen en Tesseract
-        tesseract_api_->SetImage(processed_image.data, 
-                                processed_image.cols,
-                                processed_image.rows,
-                                1,  // bytes per pixel
-                                processed_image.step);
+        engine.SetImage(processed_image.data, 
+                        processed_image.cols,
+                        processed_image.rows,
+                        1,  // bytes per pixel
+                        processed_image.step);
+        
+        // Con monitor, la lectura se puede cancelar (resultado descartado)
+        if (engine.Recognize(monitor) != 0) {
+            return OCRResult();
+        }
         
+        // Por carácter: la mejor letra en 1-3 y el mejor dígito en 4-6
+        OCRResult positional = PlateLayoutDecoder::decode(extractSymbols(engine),
+                                                           layout_substitution_confidence_);
+        if (!positional.text.empty()) {
+            return positional.confidence < confidence_threshold_ ? OCRResult() : positional;
+        }
+        
+        // Sin disposición de placa: texto libre (la normalización decide)
         // Obtener texto y confianza
-        char* text = tesseract_api_->GetUTF8Text();
-        int* confidences = tesseract_api_->AllWordConfidences();
+        char* text = engine.GetUTF8Text();
+        int* confidences = engine.AllWordConfidences();
         
         std::string result_text = text ? std::string(text) : "";
         
@@ -280,46 +596,62 @@ OCRResult OCRProcessor::recognizeInternal(const cv::Mat& processed_image) {
     }
 }
 
-std::vector<cv::Mat> OCRProcessor::applyMultipleThresholds(const cv::Mat& gray) {
-    std::vector<cv::Mat> results;
-    
-    // 1. Threshold de Otsu
-    cv::Mat otsu;
-    cv::threshold(gray, otsu, 0, 255, cv::THRESH_BINARY + cv::THRESH_OTSU);
-    results.push_back(otsu);
-    
-    // 2. Threshold de Otsu inverso
-    cv::Mat otsu_inv;
-    cv::threshold(gray, otsu_inv, 0, 255, cv::THRESH_BINARY_INV + cv::THRESH_OTSU);
-    results.push_back(otsu_inv);
-    
-    // 3. Threshold adaptativo (media)
-    cv::Mat adaptive_mean;
-    cv::adaptiveThreshold(gray, adaptive_mean, 255,
-                         cv::ADAPTIVE_THRESH_MEAN_C,
-                         cv::THRESH_BINARY, 11, 2);
-    results.push_back(adaptive_mean);
+std::vector<SymbolAlternatives> OCRProcessor::extractSymbols(tesseract::TessBaseAPI& engine) {
+    std::vector<SymbolAlternatives> symbols;
     
-    // 4. Threshold adaptativo (Gaussiano)
-    cv::Mat adaptive_gauss;
-    cv::adaptiveThreshold(gray, adaptive_gauss, 255,
-                         cv::ADAPTIVE_THRESH_GAUSSIAN_C,
-                         cv::THRESH_BINARY, 11, 2);
-    results.push_back(adaptive_gauss);
-    
-    // 5. Thresholds manuales (varios valores)
-    std::vector<int> thresholds = {80, 100, 120, 140};
-    for (int thresh : thresholds) {
-        cv::Mat manual;
-        cv::threshold(gray, manual, thresh, 255, cv::THRESH_BINARY);
-        results.push_back(manual);
-        
-        cv::Mat manual_inv;
-        cv::threshold(gray, manual_inv, thresh, 255, cv::THRESH_BINARY_INV);
-        results.push_back(manual_inv);
+    std::unique_ptr<tesseract::ResultIterator> it(engine.GetIterator());
+    if (!it) {
+        return symbols;
     }
     
-    return results;
+    auto add = [](SymbolAlternatives& alternatives, const char* text, float confidence) {
+        // Solo símbolos de un carácter alfanumérico (el whitelist ya filtra casi todo)
+        if (!text || !std::isalnum(static_cast<unsigned char>(text[0])) || text[1] != '\0') {
+            return;
+        }
+        char c = static_cast<char>(std::toupper(static_cast<unsigned char>(text[0])));
+        confidence = std::max(0.0f, std::min(1.0f, confidence / 100.0f));
+        
+        for (SymbolChoice& choice : alternatives) {
+            if (choice.character == c) {
+                choice.confidence = std::max(choice.confidence, confidence);
+                return;
+            }
+        }
+        alternatives.emplace_back(c, confidence);
+    };
+    
+    do {
+        if (it->Empty(tesseract::RIL_SYMBOL)) {
+            continue;
+        }
+        
+        // Primero la elección de Tesseract, luego sus alternativas
+        SymbolAlternatives alternatives;
+        std::unique_ptr<char[]> text(it->GetUTF8Text(tesseract::RIL_SYMBOL));
+        add(alternatives, text.get(), it->Confidence(tesseract::RIL_SYMBOL));
+        
+        tesseract::ChoiceIterator choice(*it);
+        do {
+            add(alternatives, choice.GetUTF8Text(), choice.Confidence());
+        } while (choice.Next());
+        
+        if (!alternatives.empty()) {
+            symbols.push_back(std::move(alternatives));
+        }
+    } while (it->Next(tesseract::RIL_SYMBOL));
+    
+    return symbols;
+}
+
+const std::vector<std::string>& OCRProcessor::strategyNames() {
+    static const std::vector<std::string> names = {
+        "otsu", "otsu_inv", "adapt_media", "adapt_gauss",
+        "fijo_80", "fijo_80_inv", "fijo_100", "fijo_100_inv",
+        "fijo_120", "fijo_120_inv", "fijo_140", "fijo_140_inv",
+        "preprocesado"
+    };
+    return names;
 }
 
 } // namespace jetson_lpr
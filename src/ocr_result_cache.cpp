@@ -0,0 +1,316 @@
+#include "ocr_result_cache.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LPR_HASH_SSE2 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define LPR_HASH_NEON 1
+#endif
+
+namespace jetson_lpr {
+
+OCRResultCache::Stripe::Stripe(size_t capacity)
+    : slots(capacity)
+{
+    free_slots.reserve(capacity);
+    for (size_t i = capacity; i > 0; --i) {
+        free_slots.push_back(static_cast<uint32_t>(i - 1));
+    }
+}
+
+OCRResultCache::OCRResultCache(const OCRCacheConfig& config)
+    : ttl_(Clock::duration::zero())
+    , capacity_(0)
+    , hits_(0)
+    , misses_(0)
+    , evictions_(0)
+    , expirations_(0)
+{
+    setConfig(config);
+}
+
+void OCRResultCache::setConfig(const OCRCacheConfig& config) {
+    config_ = config;
+    config_.max_distance = std::max(0, std::min(BANDS - 1, config_.max_distance));
+
+    ttl_ = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(std::max(0.0, config_.ttl_seconds)));
+
+    // La capacidad se reserva completa: el límite de bytes se traduce a entradas
+    capacity_ = config_.max_entries;
+    if (config_.max_bytes > 0) {
+        capacity_ = std::min(capacity_, config_.max_bytes / bytesPerEntry());
+    }
+
+    stripes_.clear();
+    if (capacity_ == 0) {
+        return;
+    }
+
+    size_t stripe_count = std::max<size_t>(1, std::min<size_t>(capacity_, std::max(1, config_.stripes)));
+    for (size_t i = 0; i < stripe_count; ++i) {
+        // Repartir el resto para que la suma sea exactamente capacity_
+        size_t capacity = capacity_ / stripe_count + (i < capacity_ % stripe_count ? 1 : 0);
+        stripes_.push_back(std::make_unique<Stripe>(capacity));
+    }
+}
+
+bool OCRResultCache::lookup(uint64_t hash, OCRResult& result) {
+    const Clock::time_point now = Clock::now();
+
+    // Primero la partición de la primera banda, donde casi siempre está la
+    // misma placa del frame anterior; solo si no está ahí, las demás (una
+    // entrada cercana con otra primera banda vive en otra partición)
+    int best_distance = config_.max_distance + 1;
+    Clock::time_point best_inserted;
+    bool found = false;
+
+    const size_t home = stripeFor(hash);
+    for (size_t k = 0; k < stripes_.size(); ++k) {
+        const auto& stripe = stripes_[(home + k) % stripes_.size()];
+        std::shared_lock<std::shared_mutex> lock(stripe->mutex);
+
+        int distance = 0;
+        int index = findNearest(*stripe, hash, now, false, distance);
+        if (index < 0) {
+            continue;
+        }
+
+        Slot& slot = stripe->slots[index];
+        // En empate, la más reciente
+        if (distance < best_distance || (distance == best_distance && slot.inserted > best_inserted)) {
+            best_distance = distance;
+            best_inserted = slot.inserted;
+            result = slot.result;
+            slot.referenced.store(true, std::memory_order_relaxed);
+            found = true;
+        }
+
+        if (best_distance == 0 || k == 0) {
+            break;
+        }
+    }
+
+    if (found) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return found;
+}
+
+void OCRResultCache::insert(uint64_t hash, const OCRResult& result) {
+    if (stripes_.empty()) {
+        return;
+    }
+
+    const Clock::time_point now = Clock::now();
+
+    // La misma placa ya guardada: actualizarla en lugar de duplicarla. Casi
+    // siempre está en su partición; si cambió la primera banda, en otra
+    const size_t home = stripeFor(hash);
+    for (size_t k = 0; k < stripes_.size(); ++k) {
+        Stripe& stripe = *stripes_[(home + k) % stripes_.size()];
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+        int distance = 0;
+        int existing = findNearest(stripe, hash, now, true, distance);
+        if (existing >= 0) {
+            unindexSlot(stripe, static_cast<uint32_t>(existing));
+            store(stripe, static_cast<uint32_t>(existing), hash, result, now);
+            return;
+        }
+    }
+
+    // Nueva: en la partición de su primera banda
+    Stripe& stripe = *stripes_[home];
+    std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+    store(stripe, allocate(stripe, now), hash, result, now);
+}
+
+void OCRResultCache::store(Stripe& stripe, uint32_t index, uint64_t hash, const OCRResult& result,
+                           Clock::time_point now) {
+    Slot& slot = stripe.slots[index];
+    slot.hash = hash;
+    slot.result = result;
+    slot.inserted = now;
+    slot.referenced.store(false, std::memory_order_relaxed);
+    indexSlot(stripe, index);
+}
+
+void OCRResultCache::clear() {
+    for (const auto& stripe : stripes_) {
+        std::unique_lock<std::shared_mutex> lock(stripe->mutex);
+
+        for (auto& table : stripe->bands) {
+            table.clear();
+        }
+        stripe->free_slots.clear();
+        for (size_t i = stripe->slots.size(); i > 0; --i) {
+            stripe->slots[i - 1].used = false;
+            stripe->free_slots.push_back(static_cast<uint32_t>(i - 1));
+        }
+        stripe->used = 0;
+        stripe->hand = 0;
+    }
+}
+
+OCRResultCache::Stats OCRResultCache::getStats() const {
+    Stats stats;
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.evictions = evictions_.load(std::memory_order_relaxed);
+    stats.expirations = expirations_.load(std::memory_order_relaxed);
+    stats.capacity = capacity_;
+    stats.bytes = capacity_ * bytesPerEntry();
+
+    stats.entries = 0;
+    for (const auto& stripe : stripes_) {
+        std::shared_lock<std::shared_mutex> lock(stripe->mutex);
+        stats.entries += stripe->used;
+    }
+
+    uint64_t lookups = stats.hits + stats.misses;
+    stats.hit_rate = lookups > 0 ? static_cast<double>(stats.hits) / lookups : 0.0;
+    return stats;
+}
+
+size_t OCRResultCache::bytesPerEntry() {
+    // Slot + texto de placa (cabe en SSO) + 4 ids en tablas con algo de sobrecarga
+    return sizeof(Slot) + BANDS * (sizeof(uint32_t) + 2 * sizeof(void*));
+}
+
+int OCRResultCache::findNearest(const Stripe& stripe, uint64_t hash, Clock::time_point now,
+                                bool include_expired, int& distance) const {
+    int best_index = -1;
+    int best_distance = config_.max_distance + 1;
+
+    for (int i = 0; i < BANDS; ++i) {
+        auto it = stripe.bands[i].find(band(hash, i));
+        if (it == stripe.bands[i].end()) {
+            continue;
+        }
+
+        for (uint32_t index : it->second) {
+            const Slot& slot = stripe.slots[index];
+            if (!include_expired && isExpired(slot, now)) {
+                continue;
+            }
+
+            int d = hammingDistance(hash, slot.hash);
+            if (d < best_distance ||
+                (d == best_distance && best_index >= 0 && slot.inserted > stripe.slots[best_index].inserted)) {
+                best_distance = d;
+                best_index = static_cast<int>(index);
+            }
+        }
+    }
+
+    distance = best_distance;
+    return best_index;
+}
+
+uint32_t OCRResultCache::allocate(Stripe& stripe, Clock::time_point now) {
+    if (!stripe.free_slots.empty()) {
+        uint32_t index = stripe.free_slots.back();
+        stripe.free_slots.pop_back();
+        stripe.slots[index].used = true;
+        stripe.used++;
+        return index;
+    }
+
+    // CLOCK: la aguja da una segunda oportunidad a las entradas consultadas
+    // desde su última pasada; una vencida sale sin segunda oportunidad.
+    // Termina en <= 2 vueltas
+    for (;;) {
+        uint32_t index = static_cast<uint32_t>(stripe.hand);
+        stripe.hand = (stripe.hand + 1) % stripe.slots.size();
+
+        Slot& slot = stripe.slots[index];
+        if (isExpired(slot, now)) {
+            expirations_.fetch_add(1, std::memory_order_relaxed);
+        } else if (slot.referenced.exchange(false, std::memory_order_relaxed)) {
+            continue;
+        } else {
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        unindexSlot(stripe, index);
+        return index;
+    }
+}
+
+void OCRResultCache::indexSlot(Stripe& stripe, uint32_t index) {
+    for (int i = 0; i < BANDS; ++i) {
+        stripe.bands[i][band(stripe.slots[index].hash, i)].push_back(index);
+    }
+}
+
+void OCRResultCache::unindexSlot(Stripe& stripe, uint32_t index) {
+    for (int i = 0; i < BANDS; ++i) {
+        auto table = stripe.bands[i].find(band(stripe.slots[index].hash, i));
+        if (table == stripe.bands[i].end()) {
+            continue;
+        }
+        std::vector<uint32_t>& ids = table->second;
+        ids.erase(std::remove(ids.begin(), ids.end(), index), ids.end());
+        if (ids.empty()) {
+            stripe.bands[i].erase(table);
+        }
+    }
+}
+
+uint64_t OCRResultCache::perceptualHash(const cv::Mat& plate) {
+    if (plate.empty()) {
+        return 0;
+    }
+
+    cv::Mat gray;
+    if (plate.channels() == 3) {
+        cv::cvtColor(plate, gray, cv::COLOR_BGR2GRAY);
+    } else if (plate.channels() == 4) {
+        cv::cvtColor(plate, gray, cv::COLOR_BGRA2GRAY);
+    } else {
+        gray = plate;
+    }
+
+    // 17 columnas -> 16 gradientes horizontales por fila, 4 filas
+    cv::Mat thumb;
+    cv::resize(gray, thumb, cv::Size(17, 4), 0, 0, cv::INTER_AREA);
+
+    uint64_t hash = 0;
+    for (int y = 0; y < thumb.rows; ++y) {
+        const uchar* row = thumb.ptr<uchar>(y);
+        uint32_t bits = 0;
+
+#if defined(LPR_HASH_SSE2)
+        // Comparación sin signo: desplazar ambos lados 0x80
+        const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+        __m128i left = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row)), bias);
+        __m128i right = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + 1)), bias);
+        bits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(right, left)));
+#elif defined(LPR_HASH_NEON)
+        static const uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+        uint8x16_t mask = vcgtq_u8(vld1q_u8(row + 1), vld1q_u8(row));
+        uint8x16_t weighted = vandq_u8(mask, vld1q_u8(weights));
+        bits = vaddv_u8(vget_low_u8(weighted)) | (static_cast<uint32_t>(vaddv_u8(vget_high_u8(weighted))) << 8);
+#else
+        for (int x = 0; x < 16; ++x) {
+            if (row[x + 1] > row[x]) {
+                bits |= 1u << x;
+            }
+        }
+#endif
+
+        hash |= static_cast<uint64_t>(bits & 0xFFFF) << (y * 16);
+    }
+
+    return hash;
+}
+
+int OCRResultCache::hammingDistance(uint64_t a, uint64_t b) {
+    return __builtin_popcountll(a ^ b);
+}
+
+} // namespace jetson_lpr
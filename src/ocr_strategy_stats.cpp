@@ -0,0 +1,77 @@
+#include "ocr_strategy_stats.h"
+#include <algorithm>
+#include <numeric>
+#include <ctime>
+
+namespace jetson_lpr {
+
+OCRStrategyStats::OCRStrategyStats(const std::vector<std::string>& names,
+                                   double decay,
+                                   int time_slots)
+    : names_(names)
+    , decay_(std::min(1.0, std::max(0.0, decay)))
+    , time_slots_(std::max(1, std::min(24, time_slots)))
+    , scores_(time_slots_, std::vector<double>(names.size(), 0.0))
+    , wins_(names.size(), 0)
+    , plates_(0)
+    , failures_(0)
+    , total_attempts_(0)
+{
+}
+
+int OCRStrategyStats::currentSlot() const {
+    std::time_t now = std::time(nullptr);
+    std::tm local{};
+    localtime_r(&now, &local);
+    return local.tm_hour * time_slots_ / 24;
+}
+
+std::vector<int> OCRStrategyStats::order() const {
+    std::vector<int> indices(names_.size());
+    std::iota(indices.begin(), indices.end(), 0);
+
+    int slot = currentSlot();
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::vector<double>& scores = scores_[slot];
+
+    // Estable: sin historia (o en empate) se conserva el orden por defecto
+    std::stable_sort(indices.begin(), indices.end(), [&scores](int a, int b) {
+        return scores[a] > scores[b];
+    });
+    return indices;
+}
+
+void OCRStrategyStats::record(int winner, int attempts) {
+    int slot = currentSlot();
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    total_attempts_ += static_cast<uint64_t>(std::max(0, attempts));
+
+    if (winner < 0 || winner >= static_cast<int>(names_.size())) {
+        failures_++;
+        return;
+    }
+
+    plates_++;
+    wins_[winner]++;
+
+    // Media móvil exponencial de "ganó esta estrategia" en la franja actual
+    for (size_t i = 0; i < scores_[slot].size(); ++i) {
+        scores_[slot][i] = decay_ * scores_[slot][i] + (static_cast<int>(i) == winner ? 1.0 - decay_ : 0.0);
+    }
+}
+
+OCRStrategyStats::Summary OCRStrategyStats::getSummary() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    Summary summary;
+    summary.names = names_;
+    summary.wins = wins_;
+    summary.plates = plates_;
+    summary.failures = failures_;
+    uint64_t total = plates_ + failures_;
+    summary.average_attempts = total > 0 ? static_cast<double>(total_attempts_) / total : 0.0;
+    return summary;
+}
+
+} // namespace jetson_lpr
@@ -0,0 +1,249 @@
+#ifdef USE_ONNXRUNTIME
+
+#include "onnxruntime_backend.h"
+#include <onnxruntime_cxx_api.h>
+#include <iostream>
+#include <filesystem>
+
+namespace jetson_lpr {
+
+// Estado interno de ONNX Runtime
+struct OrtSessionHolder {
+    Ort::Env env;
+    Ort::SessionOptions session_options;
+    std::unique_ptr<Ort::Session> session;
+    std::unique_ptr<Ort::IoBinding> binding;
+    Ort::MemoryInfo memory_info;
+
+    std::vector<std::string> input_names;
+    std::vector<std::string> output_names;
+    std::vector<std::vector<int64_t>> output_shapes;  // -1 = dimensión dinámica
+
+    // Estado del enlace actual
+    const void* bound_input_ptr;
+    std::vector<int64_t> bound_input_shape;
+    std::vector<Ort::Value> bound_values;       // Tensores enlazados (entrada + salidas propias)
+    std::vector<cv::Mat> output_buffers;        // Buffers propios de salida
+    std::vector<Ort::Value> output_values;      // Salidas asignadas por ORT (formas dinámicas)
+    bool outputs_preallocated;
+
+    OrtSessionHolder()
+        : env(ORT_LOGGING_LEVEL_WARNING, "jetson_lpr")
+        , memory_info(Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault))
+        , bound_input_ptr(nullptr)
+        , outputs_preallocated(false)
+    {}
+};
+
+OnnxRuntimeBackend::OnnxRuntimeBackend(const InferenceOptions& options)
+    : options_(options)
+    , session_(nullptr)
+{
+}
+
+OnnxRuntimeBackend::~OnnxRuntimeBackend() = default;
+
+bool OnnxRuntimeBackend::load(const std::string& model_path) {
+    namespace fs = std::filesystem;
+
+    try {
+        session_ = std::make_unique<OrtSessionHolder>();
+        Ort::SessionOptions& session_options = session_->session_options;
+
+        // Control de hilos
+        if (options_.intra_op_threads > 0) {
+            session_options.SetIntraOpNumThreads(options_.intra_op_threads);
+        }
+        if (options_.inter_op_threads > 0) {
+            session_options.SetInterOpNumThreads(options_.inter_op_threads);
+            session_options.SetExecutionMode(ExecutionMode::ORT_PARALLEL);
+        }
+
+        // Cache del grafo optimizado: reutilizarlo si es más reciente que el modelo
+        std::string path_to_load = model_path;
+        const std::string& cache_path = options_.optimized_model_cache;
+        std::error_code ec;
+        bool cache_valid = !cache_path.empty() && fs::exists(cache_path, ec) &&
+            fs::last_write_time(cache_path, ec) >= fs::last_write_time(model_path, ec) && !ec;
+
+        if (cache_valid) {
+            // El grafo ya está optimizado, no repetir el trabajo al arrancar
+            path_to_load = cache_path;
+            session_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_DISABLE_ALL);
+            std::cout << "📦 Usando grafo optimizado en cache: " << cache_path << std::endl;
+        } else if (options_.graph_optimization) {
+            session_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
+            if (!cache_path.empty()) {
+                session_options.SetOptimizedModelFilePath(cache_path.c_str());
+            }
+        } else {
+            session_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_DISABLE_ALL);
+        }
+
+        if (options_.use_cuda) {
+            try {
+                OrtCUDAProviderOptions cuda_options;
+                session_options.AppendExecutionProvider_CUDA(cuda_options);
+                std::cout << "✅ ONNX Runtime con proveedor CUDA" << std::endl;
+            } catch (const Ort::Exception&) {
+                std::cout << "⚠️ Proveedor CUDA no disponible en ONNX Runtime, usando CPU" << std::endl;
+            }
+        }
+
+        session_->session = std::make_unique<Ort::Session>(
+            session_->env, path_to_load.c_str(), session_options
+        );
+
+        // Nombres y formas de entradas/salidas
+        Ort::AllocatorWithDefaultOptions allocator;
+        Ort::Session& session = *session_->session;
+
+        for (size_t i = 0; i < session.GetInputCount(); ++i) {
+            session_->input_names.emplace_back(session.GetInputNameAllocated(i, allocator).get());
+        }
+
+        for (size_t i = 0; i < session.GetOutputCount(); ++i) {
+            session_->output_names.emplace_back(session.GetOutputNameAllocated(i, allocator).get());
+            session_->output_shapes.push_back(
+                session.GetOutputTypeInfo(i).GetTensorTypeAndShapeInfo().GetShape()
+            );
+        }
+
+        if (session_->input_names.empty() || session_->output_names.empty()) {
+            std::cerr << "Error: El modelo no tiene entradas/salidas: " << model_path << std::endl;
+            session_.reset();
+            return false;
+        }
+
+        // Los modelos QDQ (INT8) se ejecutan con kernels cuantizados tras la
+        // fusión de nodos Q/DQ; requiere optimización de grafo habilitada
+        std::string precision = detectModelPrecision(model_path);
+        if (precision == "int8" && !options_.graph_optimization && !cache_valid) {
+            std::cout << "⚠️ Modelo INT8 sin optimización de grafo: los nodos Q/DQ no se fusionarán" << std::endl;
+        }
+        if (options_.precision == "fp16") {
+            std::cout << "⚠️ ONNX Runtime no convierte a FP16 en carga; exporte un modelo FP16" << std::endl;
+        }
+
+        std::cout << "✅ Modelo cargado con ONNX Runtime (hilos intra/inter: "
+                  << options_.intra_op_threads << "/" << options_.inter_op_threads
+                  << ", precisión " << precision << ")" << std::endl;
+
+        return true;
+
+    } catch (const Ort::Exception& e) {
+        std::cerr << "Error ONNX Runtime al cargar modelo: " << e.what() << std::endl;
+        session_.reset();
+        return false;
+    }
+}
+
+bool OnnxRuntimeBackend::bind(const cv::Mat& blob) {
+    std::vector<int64_t> input_shape;
+    for (int i = 0; i < blob.dims; ++i) {
+        input_shape.push_back(blob.size[i]);
+    }
+
+    // Mismo buffer y misma forma: el enlace anterior sigue siendo válido
+    if (session_->binding &&
+        session_->bound_input_ptr == blob.data &&
+        session_->bound_input_shape == input_shape) {
+        return true;
+    }
+
+    session_->binding = std::make_unique<Ort::IoBinding>(*session_->session);
+    session_->bound_values.clear();
+
+    // Entrada: enlazar directamente el buffer del blob (sin copia)
+    session_->bound_values.push_back(Ort::Value::CreateTensor<float>(
+        session_->memory_info,
+        reinterpret_cast<float*>(blob.data),
+        blob.total(),
+        input_shape.data(),
+        input_shape.size()
+    ));
+    session_->binding->BindInput(session_->input_names[0].c_str(), session_->bound_values.back());
+
+    // Salidas: buffers propios si la forma es estática (el batch se toma de la entrada)
+    session_->outputs_preallocated = true;
+    session_->output_buffers.resize(session_->output_names.size());
+
+    for (size_t i = 0; i < session_->output_names.size(); ++i) {
+        std::vector<int64_t> shape = session_->output_shapes[i];
+        if (!shape.empty() && shape[0] < 0) {
+            shape[0] = input_shape[0];
+        }
+
+        bool is_static = !shape.empty();
+        for (int64_t dim : shape) {
+            if (dim <= 0) {
+                is_static = false;
+            }
+        }
+
+        if (is_static) {
+            std::vector<int> sizes(shape.begin(), shape.end());
+            session_->output_buffers[i].create(sizes, CV_32F);
+
+            session_->bound_values.push_back(Ort::Value::CreateTensor<float>(
+                session_->memory_info,
+                session_->output_buffers[i].ptr<float>(),
+                session_->output_buffers[i].total(),
+                shape.data(),
+                shape.size()
+            ));
+            session_->binding->BindOutput(session_->output_names[i].c_str(), session_->bound_values.back());
+        } else {
+            // Forma dinámica: ORT asigna la salida en cada ejecución
+            session_->binding->BindOutput(session_->output_names[i].c_str(), session_->memory_info);
+            session_->outputs_preallocated = false;
+        }
+    }
+
+    session_->bound_input_ptr = blob.data;
+    session_->bound_input_shape = input_shape;
+
+    return true;
+}
+
+bool OnnxRuntimeBackend::infer(const cv::Mat& blob, std::vector<cv::Mat>& outputs) {
+    if (!session_ || !session_->session || blob.empty() || !blob.isContinuous()) {
+        return false;
+    }
+
+    try {
+        if (!bind(blob)) {
+            return false;
+        }
+
+        session_->session->Run(Ort::RunOptions{nullptr}, *session_->binding);
+
+        outputs.clear();
+
+        if (session_->outputs_preallocated) {
+            // Cabeceras cv::Mat sobre los buffers enlazados (sin copia)
+            outputs = session_->output_buffers;
+            return true;
+        }
+
+        // Mantener vivos los valores de ORT mientras se usan las salidas
+        session_->output_values = session_->binding->GetOutputValues();
+        for (auto& value : session_->output_values) {
+            std::vector<int64_t> shape = value.GetTensorTypeAndShapeInfo().GetShape();
+            std::vector<int> sizes(shape.begin(), shape.end());
+            outputs.emplace_back(sizes, CV_32F, value.GetTensorMutableData<float>());
+        }
+
+        return true;
+
+    } catch (const Ort::Exception& e) {
+        std::cerr << "Error en inferencia (ONNX Runtime): " << e.what() << std::endl;
+        // Forzar re-enlace en la siguiente llamada
+        session_->binding.reset();
+        return false;
+    }
+}
+
+} // namespace jetson_lpr
+
+#endif // USE_ONNXRUNTIME
@@ -0,0 +1,102 @@
+#include "opencv_dnn_backend.h"
+#include <iostream>
+
+namespace jetson_lpr {
+
+OpenCVDnnBackend::OpenCVDnnBackend(const InferenceOptions& options)
+    : options_(options)
+{
+}
+
+bool OpenCVDnnBackend::load(const std::string& model_path) {
+    try {
+        // Intentar cargar modelo ONNX
+        std::string extension = model_path.substr(model_path.find_last_of(".") + 1);
+
+        if (extension == "onnx") {
+            net_ = cv::dnn::readNetFromONNX(model_path);
+        } else if (extension == "xml" || extension == "bin") {
+            // OpenVINO format
+            net_ = cv::dnn::readNet(model_path);
+        } else {
+            std::cerr << "Error: Formato de modelo no soportado: " << extension << std::endl;
+            std::cerr << "Soporta: .onnx, .xml/.bin (OpenVINO)" << std::endl;
+            return false;
+        }
+
+        if (net_.empty()) {
+            std::cerr << "Error: No se pudo cargar el modelo: " << model_path << std::endl;
+            return false;
+        }
+
+        if (options_.intra_op_threads > 0) {
+            cv::setNumThreads(options_.intra_op_threads);
+        }
+
+        // Precisión: INT8 (QDQ) solo tiene kernels en CPU
+        std::string precision = options_.precision == "auto"
+            ? detectModelPrecision(model_path)
+            : options_.precision;
+        bool fp16 = (precision == "fp16");
+        
+        // Configurar backend preferido
+        // En Jetson, intentar CUDA primero, luego CPU
+        #ifdef USE_CUDA
+        if (options_.use_cuda && precision != "int8") {
+            try {
+                net_.setPreferableBackend(cv::dnn::DNN_BACKEND_CUDA);
+                net_.setPreferableTarget(fp16 ? cv::dnn::DNN_TARGET_CUDA_FP16 : cv::dnn::DNN_TARGET_CUDA);
+                std::cout << "✅ Modelo cargado con backend CUDA (" << precision << ")" << std::endl;
+            } catch (const cv::Exception&) {
+                std::cout << "⚠️ CUDA no disponible, usando CPU" << std::endl;
+                setCpuTarget(fp16);
+            }
+        } else {
+            setCpuTarget(fp16);
+            std::cout << "✅ Modelo cargado con backend CPU (" << precision << ")" << std::endl;
+        }
+        #else
+        setCpuTarget(fp16);
+        std::cout << "✅ Modelo cargado con backend CPU (" << precision << ")" << std::endl;
+        #endif
+
+        output_names_ = net_.getUnconnectedOutLayersNames();
+
+        return true;
+
+    } catch (const cv::Exception& e) {
+        std::cerr << "Error OpenCV al cargar modelo: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void OpenCVDnnBackend::setCpuTarget(bool fp16) {
+    net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+    
+    #if CV_VERSION_MAJOR > 4 || (CV_VERSION_MAJOR == 4 && CV_VERSION_MINOR >= 9)
+    // FP16 en CPU (ARMv8.2+ en Jetson Orin); OpenCV hace fallback a FP32 si no hay soporte
+    net_.setPreferableTarget(fp16 ? cv::dnn::DNN_TARGET_CPU_FP16 : cv::dnn::DNN_TARGET_CPU);
+    #else
+    if (fp16) {
+        std::cout << "⚠️ FP16 en CPU requiere OpenCV >= 4.9, usando FP32" << std::endl;
+    }
+    net_.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+    #endif
+}
+
+bool OpenCVDnnBackend::infer(const cv::Mat& blob, std::vector<cv::Mat>& outputs) {
+    if (net_.empty()) {
+        return false;
+    }
+
+    try {
+        net_.setInput(blob);
+        net_.forward(outputs, output_names_);
+        return true;
+    } catch (const cv::Exception& e) {
+        std::cerr << "Error en inferencia (OpenCV DNN): " << e.what() << std::endl;
+        return false;
+    }
+}
+
+} // namespace jetson_lpr
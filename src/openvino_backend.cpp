@@ -0,0 +1,252 @@
+#ifdef USE_OPENVINO
+
+#include "openvino_backend.h"
+#include <openvino/openvino.hpp>
+#include <iostream>
+#include <mutex>
+#include <condition_variable>
+
+namespace jetson_lpr {
+
+namespace {
+
+ov::Shape toShape(const cv::Mat& blob) {
+    ov::Shape shape;
+    for (int i = 0; i < blob.dims; ++i) {
+        shape.push_back(static_cast<size_t>(blob.size[i]));
+    }
+    return shape;
+}
+
+void collectOutputs(ov::InferRequest& request, size_t num_outputs, std::vector<cv::Mat>& outputs) {
+    outputs.clear();
+    for (size_t i = 0; i < num_outputs; ++i) {
+        ov::Tensor tensor = request.get_output_tensor(i);
+        const ov::Shape& shape = tensor.get_shape();
+        std::vector<int> sizes(shape.begin(), shape.end());
+        // Copia: la solicitud vuelve al pool y otra inferencia reescribe su tensor
+        outputs.push_back(cv::Mat(sizes, CV_32F, tensor.data<float>()).clone());
+    }
+}
+
+} // namespace
+
+// Solicitud de inferencia con su buffer de entrada propio
+struct OpenVINOSlot {
+    ov::InferRequest request;
+    cv::Mat input;
+    InferenceCallback callback;
+};
+
+// Estado interno de OpenVINO
+struct OpenVINOState {
+    ov::Core core;
+    ov::CompiledModel compiled;
+    size_t num_outputs;
+
+    std::vector<std::unique_ptr<OpenVINOSlot>> slots;
+    std::vector<size_t> free_slots;
+    std::mutex mutex;
+    std::condition_variable slot_available;
+
+    OpenVINOState() : num_outputs(0) {}
+};
+
+OpenVINOBackend::OpenVINOBackend(const InferenceOptions& options)
+    : options_(options)
+    , state_(nullptr)
+{
+}
+
+OpenVINOBackend::~OpenVINOBackend() {
+    waitAll();
+}
+
+bool OpenVINOBackend::load(const std::string& model_path) {
+    try {
+        state_ = std::make_unique<OpenVINOState>();
+
+        // Para IR se lee el .xml (el .bin se resuelve automáticamente)
+        std::string path = model_path;
+        std::string extension = path.substr(path.find_last_of(".") + 1);
+        if (extension == "bin") {
+            path = path.substr(0, path.size() - 3) + "xml";
+        }
+
+        if (!options_.optimized_model_cache.empty()) {
+            // Cache de modelos compilados (directorio)
+            state_->core.set_property(ov::cache_dir(options_.optimized_model_cache));
+        }
+
+        std::shared_ptr<ov::Model> model = state_->core.read_model(path);
+
+        ov::AnyMap config;
+        config.emplace(ov::hint::performance_mode.name(), ov::hint::PerformanceMode::THROUGHPUT);
+        if (options_.num_requests > 0) {
+            config.emplace(ov::hint::num_requests.name(), static_cast<uint32_t>(options_.num_requests));
+        }
+        if (options_.intra_op_threads > 0) {
+            config.emplace(ov::inference_num_threads.name(), options_.intra_op_threads);
+        }
+        if (options_.precision == "fp16") {
+            config.emplace(ov::hint::inference_precision.name(), ov::element::f16);
+        } else if (options_.precision == "fp32") {
+            // Evitar que el plugin baje a bf16/fp16 por su cuenta
+            config.emplace(ov::hint::inference_precision.name(), ov::element::f32);
+        }
+        // Modelos QDQ (INT8): OpenVINO ejecuta los nodos cuantizados con kernels INT8
+
+        state_->compiled = state_->core.compile_model(model, options_.device, config);
+        state_->num_outputs = state_->compiled.outputs().size();
+
+        uint32_t num_requests = options_.num_requests > 0
+            ? static_cast<uint32_t>(options_.num_requests)
+            : state_->compiled.get_property(ov::optimal_number_of_infer_requests);
+
+        for (uint32_t i = 0; i < num_requests; ++i) {
+            auto slot = std::make_unique<OpenVINOSlot>();
+            slot->request = state_->compiled.create_infer_request();
+
+            size_t index = i;
+            slot->request.set_callback([this, index](std::exception_ptr error) {
+                onRequestComplete(index, error);
+            });
+
+            state_->slots.push_back(std::move(slot));
+            state_->free_slots.push_back(index);
+        }
+
+        std::cout << "✅ Modelo cargado con OpenVINO (" << options_.device
+                  << ", " << num_requests << " solicitudes en paralelo, precisión "
+                  << (options_.precision == "auto" ? detectModelPrecision(path) : options_.precision)
+                  << ")" << std::endl;
+
+        return true;
+
+    } catch (const ov::Exception& e) {
+        std::cerr << "Error OpenVINO al cargar modelo: " << e.what() << std::endl;
+        state_.reset();
+        return false;
+    }
+}
+
+bool OpenVINOBackend::infer(const cv::Mat& blob, std::vector<cv::Mat>& outputs) {
+    if (!state_ || state_->slots.empty() || blob.empty() || !blob.isContinuous()) {
+        return false;
+    }
+
+    size_t index = acquireRequest();
+    OpenVINOSlot& slot = *state_->slots[index];
+    bool ok = true;
+
+    try {
+        // Síncrono: enlazar el blob del llamador directamente
+        slot.request.set_input_tensor(ov::Tensor(ov::element::f32, toShape(blob), blob.data));
+        slot.request.infer();
+        collectOutputs(slot.request, state_->num_outputs, outputs);
+    } catch (const ov::Exception& e) {
+        std::cerr << "Error en inferencia (OpenVINO): " << e.what() << std::endl;
+        ok = false;
+    }
+
+    releaseRequest(index);
+    return ok;
+}
+
+bool OpenVINOBackend::inferAsync(const cv::Mat& blob, InferenceCallback callback) {
+    if (!state_ || state_->slots.empty() || blob.empty()) {
+        std::vector<cv::Mat> no_outputs;
+        callback(false, no_outputs);
+        return false;
+    }
+
+    size_t index = acquireRequest();
+    OpenVINOSlot& slot = *state_->slots[index];
+
+    try {
+        // Copia propia: el llamador puede reutilizar su blob en el siguiente frame
+        blob.copyTo(slot.input);
+        slot.callback = std::move(callback);
+
+        slot.request.set_input_tensor(
+            ov::Tensor(ov::element::f32, toShape(slot.input), slot.input.data)
+        );
+        slot.request.start_async();
+        return true;
+
+    } catch (const ov::Exception& e) {
+        std::cerr << "Error lanzando inferencia asíncrona (OpenVINO): " << e.what() << std::endl;
+
+        InferenceCallback failed = std::move(slot.callback);
+        slot.callback = nullptr;
+        releaseRequest(index);
+
+        std::vector<cv::Mat> no_outputs;
+        if (failed) {
+            failed(false, no_outputs);
+        }
+        return false;
+    }
+}
+
+void OpenVINOBackend::onRequestComplete(size_t index, std::exception_ptr error) {
+    OpenVINOSlot& slot = *state_->slots[index];
+    std::vector<cv::Mat> outputs;
+    bool ok = (error == nullptr);
+
+    if (error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception& e) {
+            std::cerr << "Error en inferencia asíncrona (OpenVINO): " << e.what() << std::endl;
+        }
+    } else {
+        try {
+            collectOutputs(slot.request, state_->num_outputs, outputs);
+        } catch (const ov::Exception& e) {
+            std::cerr << "Error leyendo salidas (OpenVINO): " << e.what() << std::endl;
+            ok = false;
+        }
+    }
+
+    // Entregar resultados al pipeline antes de liberar la solicitud
+    InferenceCallback callback = std::move(slot.callback);
+    slot.callback = nullptr;
+    if (callback) {
+        callback(ok, outputs);
+    }
+
+    releaseRequest(index);
+}
+
+size_t OpenVINOBackend::acquireRequest() {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->slot_available.wait(lock, [this]() { return !state_->free_slots.empty(); });
+
+    size_t index = state_->free_slots.back();
+    state_->free_slots.pop_back();
+    return index;
+}
+
+void OpenVINOBackend::releaseRequest(size_t index) {
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->free_slots.push_back(index);
+    }
+    state_->slot_available.notify_all();
+}
+
+void OpenVINOBackend::waitAll() {
+    if (!state_) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->slot_available.wait(lock, [this]() {
+        return state_->free_slots.size() == state_->slots.size();
+    });
+}
+
+} // namespace jetson_lpr
+
+#endif // USE_OPENVINO
@@ -0,0 +1,98 @@
+#include "plate_layout_decoder.h"
+#include "plate_validator.h"
+
+namespace jetson_lpr {
+
+namespace {
+
+// Disposiciones de 6 caracteres que acepta PlateValidator
+const char* const LAYOUTS[] = {
+    "AAA999",   // Estándar: ABC123
+    "CD9999"    // Diplomática: CD1234
+};
+
+// Una confusión conocida vale menos que una alternativa real del OCR
+constexpr float CONFUSION_PENALTY = 0.5f;
+
+bool matches(char slot, char c) {
+    if (slot == 'A') {
+        return c >= 'A' && c <= 'Z';
+    }
+    if (slot == '9') {
+        return c >= '0' && c <= '9';
+    }
+    return c == slot;
+}
+
+} // namespace
+
+OCRResult PlateLayoutDecoder::decode(const std::vector<SymbolAlternatives>& symbols,
+                                     float min_substitution) {
+    OCRResult best;
+
+    for (const char* layout : LAYOUTS) {
+        const std::string pattern(layout);
+        if (symbols.size() < pattern.size()) {
+            continue;
+        }
+
+        for (size_t first = 0; first + pattern.size() <= symbols.size(); ++first) {
+            OCRResult candidate = fitLayout(pattern, symbols, first, min_substitution);
+            if (!candidate.text.empty() && candidate.confidence > best.confidence) {
+                best = std::move(candidate);
+            }
+        }
+    }
+
+    return best;
+}
+
+OCRResult PlateLayoutDecoder::fitLayout(const std::string& layout,
+                                        const std::vector<SymbolAlternatives>& symbols, size_t first,
+                                        float min_substitution) {
+    OCRResult result;
+    float sum = 0.0f;
+
+    for (size_t slot = 0; slot < layout.size(); ++slot) {
+        const SymbolAlternatives& alternatives = symbols[first + slot];
+        if (alternatives.empty()) {
+            return OCRResult();
+        }
+
+        // Mejor alternativa de la clase de esta posición
+        char chosen = 0;
+        float confidence = 0.0f;
+        for (const SymbolChoice& choice : alternatives) {
+            if (matches(layout[slot], choice.character) && choice.confidence > confidence) {
+                chosen = choice.character;
+                confidence = choice.confidence;
+            }
+        }
+
+        // Ninguna: confusión conocida de la primera alternativa
+        if (chosen == 0) {
+            const SymbolChoice& top = alternatives.front();
+            char mapped = layout[slot] == '9' ? PlateValidator::letterAsDigit(top.character)
+                        : PlateValidator::digitAsLetter(top.character);
+            if (mapped == 0 || !matches(layout[slot], mapped)) {
+                return OCRResult();
+            }
+            chosen = mapped;
+            confidence = top.confidence * CONFUSION_PENALTY;
+        }
+
+        // Cambiar lo que leyó el OCR solo con evidencia suficiente
+        if (chosen != alternatives.front().character && confidence < min_substitution) {
+            return OCRResult();
+        }
+
+        result.text += chosen;
+        result.char_confidences.push_back(confidence);
+        sum += confidence;
+    }
+
+    result.confidence = sum / layout.size();
+    return result;
+}
+
+} // namespace jetson_lpr
@@ -0,0 +1,194 @@
+#include "plate_prefilter.h"
+#include <algorithm>
+
+namespace jetson_lpr {
+
+namespace {
+
+// Umbrales HSV (escala OpenCV: H 0-179, S y V 0-255)
+constexpr int YELLOW_HUE_MIN = 15;
+constexpr int YELLOW_HUE_MAX = 40;
+constexpr int BLUE_HUE_MIN = 95;
+constexpr int BLUE_HUE_MAX = 130;
+constexpr int COLOR_SAT_MIN = 80;
+constexpr int COLOR_VAL_MIN = 70;
+constexpr int WHITE_SAT_MAX = 50;
+constexpr int WHITE_VAL_MIN = 140;
+
+// Saturación media por debajo de la cual el recorte es gris (IR de noche)
+constexpr double GRAYSCALE_SAT_MAX = 20.0;
+
+// La prueba de color trabaja sobre una versión reducida de la placa
+constexpr int COLOR_SAMPLE_WIDTH = 48;
+
+} // namespace
+
+PlatePrefilter::PlatePrefilter(const PrefilterConfig& config)
+    : config_(config)
+    , accepted_(0)
+    , rejected_size_(0)
+    , rejected_aspect_(0)
+    , rejected_edge_(0)
+    , rejected_color_(0)
+{
+}
+
+PrefilterResult PlatePrefilter::evaluate(const cv::Mat& frame, const cv::Rect& bbox) {
+    PrefilterResult result;
+
+    if (bbox.width < config_.min_width || bbox.height < config_.min_height) {
+        result.reason = PrefilterReason::SIZE;
+        return finish(result);
+    }
+
+    float aspect = static_cast<float>(bbox.width) / bbox.height;
+    if (aspect < config_.min_aspect || aspect > config_.max_aspect) {
+        result.reason = PrefilterReason::ASPECT;
+        return finish(result);
+    }
+
+    // Una placa cortada por el borde no se puede leer completa
+    if (config_.edge_margin > 0 &&
+        (bbox.x < config_.edge_margin ||
+         bbox.y < config_.edge_margin ||
+         bbox.br().x > frame.cols - config_.edge_margin ||
+         bbox.br().y > frame.rows - config_.edge_margin)) {
+        result.reason = PrefilterReason::EDGE;
+        return finish(result);
+    }
+
+    cv::Rect roi = bbox & cv::Rect(0, 0, frame.cols, frame.rows);
+    if (roi.empty()) {
+        result.reason = PrefilterReason::EDGE;
+        return finish(result);
+    }
+
+    if (config_.color_check && frame.channels() == 3) {
+        bool grayscale = false;
+        PlateType color = classifyColor(frame(roi), result.color_ratio, grayscale);
+
+        // Cámara en IR: sin color no hay tipo, pero la placa sigue siendo legible
+        if (grayscale) {
+            result.accepted = true;
+            return finish(result);
+        }
+
+        if (result.color_ratio < config_.min_color_ratio) {
+            result.reason = PrefilterReason::COLOR;
+            return finish(result);
+        }
+
+        // Las placas de moto son amarillas pero casi cuadradas (dos renglones)
+        if (color == PlateType::PARTICULAR && aspect < config_.moto_max_aspect) {
+            color = PlateType::MOTO;
+        }
+        result.type = color;
+    }
+
+    result.accepted = true;
+    return finish(result);
+}
+
+PlateType PlatePrefilter::classifyColor(const cv::Mat& plate, float& ratio, bool& grayscale) const {
+    ratio = 0.0f;
+    grayscale = false;
+
+    // Centro de la placa: el marco y los tornillos sesgan el color del borde
+    cv::Rect inner(plate.cols / 8, plate.rows / 6,
+                   plate.cols - plate.cols / 4, plate.rows - plate.rows / 3);
+    if (inner.width <= 0 || inner.height <= 0) {
+        inner = cv::Rect(0, 0, plate.cols, plate.rows);
+    }
+
+    cv::Mat sample;
+    int sample_width = std::min(COLOR_SAMPLE_WIDTH, inner.width);
+    int sample_height = std::max(1, inner.height * sample_width / inner.width);
+    cv::resize(plate(inner), sample, cv::Size(sample_width, sample_height), 0, 0, cv::INTER_AREA);
+
+    cv::Mat hsv;
+    cv::cvtColor(sample, hsv, cv::COLOR_BGR2HSV);
+
+    // Frames de 3 canales con el mismo valor en los tres: el amarillo
+    // retrorreflectivo pasaría por blanco y una placa oscura por ningún color
+    if (cv::mean(hsv)[1] < GRAYSCALE_SAT_MAX) {
+        grayscale = true;
+        return PlateType::UNKNOWN;
+    }
+
+    int yellow = 0;
+    int white = 0;
+    int blue = 0;
+    for (int y = 0; y < hsv.rows; ++y) {
+        const cv::Vec3b* row = hsv.ptr<cv::Vec3b>(y);
+        for (int x = 0; x < hsv.cols; ++x) {
+            int h = row[x][0];
+            int s = row[x][1];
+            int v = row[x][2];
+
+            if (s <= WHITE_SAT_MAX && v >= WHITE_VAL_MIN) {
+                white++;
+            } else if (s >= COLOR_SAT_MIN && v >= COLOR_VAL_MIN) {
+                if (h >= YELLOW_HUE_MIN && h <= YELLOW_HUE_MAX) {
+                    yellow++;
+                } else if (h >= BLUE_HUE_MIN && h <= BLUE_HUE_MAX) {
+                    blue++;
+                }
+            }
+        }
+    }
+
+    const float total = static_cast<float>(hsv.rows * hsv.cols);
+    if (total <= 0.0f) {
+        return PlateType::UNKNOWN;
+    }
+
+    // Color de fondo dominante
+    PlateType type = PlateType::PARTICULAR;
+    int best = yellow;
+    if (white > best) {
+        type = PlateType::PUBLICO;
+        best = white;
+    }
+    if (blue > best) {
+        type = PlateType::DIPLOMATICO;
+        best = blue;
+    }
+
+    ratio = best / total;
+    return ratio >= config_.min_color_ratio ? type : PlateType::UNKNOWN;
+}
+
+PrefilterResult PlatePrefilter::finish(PrefilterResult result) {
+    switch (result.reason) {
+        case PrefilterReason::ACCEPTED: accepted_++; break;
+        case PrefilterReason::SIZE: rejected_size_++; break;
+        case PrefilterReason::ASPECT: rejected_aspect_++; break;
+        case PrefilterReason::EDGE: rejected_edge_++; break;
+        case PrefilterReason::COLOR: rejected_color_++; break;
+    }
+    return result;
+}
+
+PlatePrefilter::Stats PlatePrefilter::getStats() const {
+    Stats stats;
+    stats.accepted = accepted_;
+    stats.rejected_size = rejected_size_;
+    stats.rejected_aspect = rejected_aspect_;
+    stats.rejected_edge = rejected_edge_;
+    stats.rejected_color = rejected_color_;
+    return stats;
+}
+
+const char* PlatePrefilter::plateTypeName(PlateType type) {
+    switch (type) {
+        case PlateType::PARTICULAR: return "particular";
+        case PlateType::PUBLICO: return "publico";
+        case PlateType::DIPLOMATICO: return "diplomatico";
+        case PlateType::MOTO: return "moto";
+        case PlateType::UNKNOWN: break;
+    }
+    // Sin clasificar: la columna queda en NULL
+    return "";
+}
+
+} // namespace jetson_lpr
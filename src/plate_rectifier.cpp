@@ -0,0 +1,225 @@
+#include "plate_rectifier.h"
+#include <algorithm>
+#include <cmath>
+
+namespace jetson_lpr {
+
+namespace {
+
+float distance(const cv::Point2f& a, const cv::Point2f& b) {
+    return std::hypot(a.x - b.x, a.y - b.y);
+}
+
+} // namespace
+
+PlateRectifier::PlateRectifier(const RectifierConfig& config)
+    : config_(config)
+    , estimated_(0)
+    , cached_(0)
+    , passthrough_(0)
+{
+    config_.lanes = std::max(1, config_.lanes);
+    config_.refresh_every = std::max(1, config_.refresh_every);
+    config_.smoothing = std::max(0.0f, std::min(1.0f, config_.smoothing));
+    lanes_.resize(config_.lanes);
+}
+
+cv::Mat PlateRectifier::rectify(const cv::Mat& frame, const cv::Rect& bbox) {
+    cv::Rect box = bbox & cv::Rect(0, 0, frame.cols, frame.rows);
+    if (box.empty()) {
+        return cv::Mat();
+    }
+
+    const int center_x = box.x + box.width / 2;
+    const int lane_index = std::min(config_.lanes - 1, center_x * config_.lanes / std::max(1, frame.cols));
+
+    // ¿Basta la geometría del carril?
+    Lane lane;
+    bool reuse = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Lane& current = lanes_[lane_index];
+        reuse = current.samples >= config_.stable_samples && current.since_refresh < config_.refresh_every;
+        if (reuse) {
+            current.since_refresh++;
+        }
+        lane = current;
+    }
+
+    Quad quad;
+    if (!reuse && estimateQuad(frame, box, quad)) {
+        // Promediar en coordenadas relativas a la caja
+        Quad relative;
+        for (int i = 0; i < 4; ++i) {
+            relative[i] = cv::Point2f((quad[i].x - box.x) / box.width, (quad[i].y - box.y) / box.height);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        Lane& current = lanes_[lane_index];
+        const float alpha = current.samples == 0 ? 1.0f : config_.smoothing;
+        for (int i = 0; i < 4; ++i) {
+            current.corners[i] = current.corners[i] * (1.0f - alpha) + relative[i] * alpha;
+        }
+        current.samples++;
+        current.since_refresh = 0;
+
+        estimated_++;
+        return warp(frame, quad);
+    }
+
+    // Contorno no encontrado (o no buscado): geometría del carril sobre esta caja
+    if (lane.samples > 0) {
+        for (int i = 0; i < 4; ++i) {
+            quad[i] = cv::Point2f(box.x + lane.corners[i].x * box.width, box.y + lane.corners[i].y * box.height);
+        }
+        cached_++;
+        return warp(frame, quad);
+    }
+
+    passthrough_++;
+    return frame(box);
+}
+
+bool PlateRectifier::estimateQuad(const cv::Mat& frame, const cv::Rect& bbox, Quad& quad) const {
+    // El detector puede cortar el borde de la placa: buscar con margen
+    const int margin_x = static_cast<int>(bbox.width * config_.margin);
+    const int margin_y = static_cast<int>(bbox.height * config_.margin);
+    const cv::Rect search = cv::Rect(bbox.x - margin_x, bbox.y - margin_y,
+                                     bbox.width + 2 * margin_x, bbox.height + 2 * margin_y) &
+                            cv::Rect(0, 0, frame.cols, frame.rows);
+    if (search.width < 8 || search.height < 4) {
+        return false;
+    }
+
+    cv::Mat gray;
+    if (frame.channels() == 3) {
+        cv::cvtColor(frame(search), gray, cv::COLOR_BGR2GRAY);
+    } else {
+        gray = frame(search);
+    }
+
+    cv::Mat edges;
+    cv::GaussianBlur(gray, gray, cv::Size(3, 3), 0);
+    cv::Canny(gray, edges, 50, 150);
+    cv::dilate(edges, edges, cv::Mat());
+
+    std::vector<std::vector<cv::Point>> contours;
+    cv::findContours(edges, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+    if (contours.empty()) {
+        return false;
+    }
+
+    // El borde de la placa es el contorno grande que rodea los caracteres
+    std::sort(contours.begin(), contours.end(), [](const std::vector<cv::Point>& a, const std::vector<cv::Point>& b) {
+        return cv::contourArea(a) > cv::contourArea(b);
+    });
+
+    // Un contorno que llena casi toda la zona de búsqueda es su borde
+    // (Canny sobre el recorte), no la placa
+    const double min_area = 0.3 * bbox.area();
+    const double search_scale = 1.0 + 2.0 * config_.margin;
+    const double max_area = 0.9 * bbox.area() * search_scale * search_scale;
+    std::vector<cv::Point2f> corners;
+    std::vector<cv::Point> largest;
+    for (const auto& contour : contours) {
+        std::vector<cv::Point> hull;
+        cv::convexHull(contour, hull);
+        const double area = cv::contourArea(hull);
+        if (area < min_area) {
+            break;
+        }
+        if (area > max_area) {
+            continue;
+        }
+        if (largest.empty()) {
+            largest = hull;
+        }
+
+        std::vector<cv::Point> approx;
+        cv::approxPolyDP(hull, approx, 0.04 * cv::arcLength(hull, true), true);
+        if (approx.size() == 4) {
+            for (const cv::Point& p : approx) {
+                corners.emplace_back(static_cast<float>(p.x + search.x), static_cast<float>(p.y + search.y));
+            }
+            break;
+        }
+    }
+
+    // Sin 4 vértices claros: al menos corregir la rotación
+    if (corners.empty()) {
+        if (largest.empty()) {
+            return false;
+        }
+        cv::Point2f points[4];
+        cv::minAreaRect(largest).points(points);
+        for (const cv::Point2f& p : points) {
+            corners.emplace_back(p.x + search.x, p.y + search.y);
+        }
+    }
+
+    quad = orderCorners(corners);
+
+    // orderCorners puede elegir el mismo vértice para dos esquinas: un
+    // cuadrilátero degenerado no sirve para warp ni para el carril
+    for (int i = 0; i < 4; ++i) {
+        for (int j = i + 1; j < 4; ++j) {
+            if (distance(quad[i], quad[j]) < 1.0f) {
+                return false;
+            }
+        }
+    }
+    if (cv::contourArea(std::vector<cv::Point2f>(quad.begin(), quad.end())) < min_area) {
+        return false;
+    }
+
+    // Forma creíble de placa: carro ~2:1, moto ~1.4:1
+    const float width = std::max(distance(quad[0], quad[1]), distance(quad[3], quad[2]));
+    const float height = std::max(distance(quad[0], quad[3]), distance(quad[1], quad[2]));
+    if (height < 4.0f || width / height < 1.0f || width / height > 6.0f) {
+        return false;
+    }
+    return true;
+}
+
+PlateRectifier::Stats PlateRectifier::getStats() const {
+    Stats stats;
+    stats.estimated = estimated_.load();
+    stats.cached = cached_.load();
+    stats.passthrough = passthrough_.load();
+    return stats;
+}
+
+PlateRectifier::Quad PlateRectifier::orderCorners(const std::vector<cv::Point2f>& points) {
+    // Sup-izq: menor x+y; inf-der: mayor x+y; sup-der: menor y-x; inf-izq: mayor y-x
+    Quad quad;
+    auto by_sum = [](const cv::Point2f& a, const cv::Point2f& b) { return a.x + a.y < b.x + b.y; };
+    auto by_diff = [](const cv::Point2f& a, const cv::Point2f& b) { return a.y - a.x < b.y - b.x; };
+    quad[0] = *std::min_element(points.begin(), points.end(), by_sum);
+    quad[2] = *std::max_element(points.begin(), points.end(), by_sum);
+    quad[1] = *std::min_element(points.begin(), points.end(), by_diff);
+    quad[3] = *std::max_element(points.begin(), points.end(), by_diff);
+    return quad;
+}
+
+cv::Mat PlateRectifier::warp(const cv::Mat& frame, const Quad& quad) {
+    // Rectángulo con los lados más largos del cuadrilátero: no se pierde resolución
+    const int width = std::max(1, static_cast<int>(std::lround(
+        std::max(distance(quad[0], quad[1]), distance(quad[3], quad[2])))));
+    const int height = std::max(1, static_cast<int>(std::lround(
+        std::max(distance(quad[0], quad[3]), distance(quad[1], quad[2])))));
+
+    const cv::Point2f destination[4] = {
+        cv::Point2f(0.0f, 0.0f),
+        cv::Point2f(static_cast<float>(width - 1), 0.0f),
+        cv::Point2f(static_cast<float>(width - 1), static_cast<float>(height - 1)),
+        cv::Point2f(0.0f, static_cast<float>(height - 1))
+    };
+
+    cv::Mat homography = cv::getPerspectiveTransform(quad.data(), destination);
+    cv::Mat rectified;
+    cv::warpPerspective(frame, rectified, homography, cv::Size(width, height),
+                        cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+    return rectified;
+}
+
+} // namespace jetson_lpr
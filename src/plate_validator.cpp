@@ -34,6 +34,16 @@ std::string PlateValidator::cleanText(const std::string& text) {
     return result;
 }
 
+char PlateValidator::letterAsDigit(char letter) {
+    auto it = CHAR_TO_INT.find(letter);
+    return it != CHAR_TO_INT.end() ? it->second : 0;
+}
+
+char PlateValidator::digitAsLetter(char digit) {
+    auto it = INT_TO_CHAR.find(digit);
+    return it != INT_TO_CHAR.end() ? it->second : 0;
+}
+
 std::string PlateValidator::normalizeColombianPlate(const std::string& raw_text) {
     if (raw_text.empty()) {
         return "";
@@ -0,0 +1,224 @@
+#include "plate_voter.h"
+#include "plate_validator.h"
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+namespace jetson_lpr {
+
+PlateVoter::PlateVoter(const PlateVoterConfig& config)
+    : config_(config)
+    , next_id_(0)
+    , stats_{}
+{
+    config_.min_reads = std::max(1, config_.min_reads);
+    config_.max_reads = std::max(config_.min_reads, config_.max_reads);
+}
+
+std::vector<int> PlateVoter::assign(const std::vector<cv::Rect>& boxes, const std::vector<float>& scores,
+                                    std::vector<VoteDecision>& expired) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Clock::time_point now = Clock::now();
+    expired.clear();
+
+    // Olvidar los vehículos que ya no están a la vista; los que no llegaron
+    // a consenso salen con la mayoría de sus lecturas
+    const auto timeout = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(config_.track_timeout_seconds));
+    tracks_.erase(std::remove_if(tracks_.begin(), tracks_.end(), [&](const Track& track) {
+        if (now - track.last_seen <= timeout) {
+            return false;
+        }
+        if (!track.resolved && track.reads > 0) {
+            float min_share = 0.0f;
+            VoteDecision decision = majority(track, min_share);
+            if (PlateValidator::isValidColombianFormat(decision.text)) {
+                decision.emit = true;
+                decision.box = track.box;
+                decision.detection_confidence = track.detection_confidence;
+                expired.push_back(decision);
+                stats_.expired++;
+            }
+        }
+        return true;
+    }), tracks_.end());
+
+    // Pares caja-vehículo por distancia de centros (en anchos de placa)
+    std::vector<std::tuple<float, size_t, size_t>> pairs;
+    for (size_t b = 0; b < boxes.size(); ++b) {
+        const cv::Point2f center(boxes[b].x + boxes[b].width * 0.5f, boxes[b].y + boxes[b].height * 0.5f);
+        for (size_t t = 0; t < tracks_.size(); ++t) {
+            const cv::Rect& previous = tracks_[t].box;
+            const cv::Point2f previous_center(previous.x + previous.width * 0.5f,
+                                              previous.y + previous.height * 0.5f);
+            const float width = static_cast<float>(std::max(1, std::max(previous.width, boxes[b].width)));
+            const float shift = std::hypot(center.x - previous_center.x, center.y - previous_center.y) / width;
+            if (shift <= config_.max_center_shift) {
+                pairs.emplace_back(shift, b, t);
+            }
+        }
+    }
+    std::sort(pairs.begin(), pairs.end());
+
+    // Asignación voraz: el par más cercano primero, cada uno una sola vez
+    std::vector<int> ids(boxes.size(), -1);
+    std::vector<bool> taken(tracks_.size(), false);
+    for (const auto& pair : pairs) {
+        const size_t b = std::get<1>(pair);
+        const size_t t = std::get<2>(pair);
+        if (ids[b] >= 0 || taken[t]) {
+            continue;
+        }
+        ids[b] = tracks_[t].id;
+        taken[t] = true;
+        tracks_[t].box = boxes[b];
+        tracks_[t].last_seen = now;
+        if (b < scores.size()) {
+            tracks_[t].detection_confidence = std::max(tracks_[t].detection_confidence, scores[b]);
+        }
+    }
+
+    for (size_t b = 0; b < boxes.size(); ++b) {
+        if (ids[b] >= 0) {
+            continue;
+        }
+        Track track;
+        track.id = next_id_++;
+        track.box = boxes[b];
+        track.last_seen = now;
+        track.detection_confidence = b < scores.size() ? scores[b] : 0.0f;
+        tracks_.push_back(track);
+        ids[b] = track.id;
+        stats_.tracks++;
+    }
+
+    return ids;
+}
+
+bool PlateVoter::isResolved(int track_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Track* track = find(track_id);
+    if (!track || !track->resolved) {
+        return false;
+    }
+
+    // Vehículo detenido mucho tiempo (o la cámara ve otro en el mismo sitio):
+    // volver a votar desde cero
+    const auto ttl = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(config_.resolved_ttl_seconds));
+    if (Clock::now() - track->resolved_at > ttl) {
+        track->resolved = false;
+        track->reads = 0;
+        track->weights = {};
+        return false;
+    }
+
+    stats_.skipped++;
+    return true;
+}
+
+VoteDecision PlateVoter::vote(int track_id, const std::string& text,
+                              const std::vector<float>& char_confidences, float confidence,
+                              const cv::Rect& vehicle_box, const std::string& plate_type) {
+    VoteDecision decision;
+    if (text.size() != POSITIONS) {
+        return decision;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Track* track = find(track_id);
+    if (!track || track->resolved) {
+        return decision;
+    }
+
+    // Datos de la última lectura, para registrar la placa si el vehículo expira
+    track->vehicle_box = vehicle_box;
+    track->plate_type = plate_type;
+
+    // Cada posición suma la confianza de su carácter (piso pequeño: una
+    // lectura sin confianza también cuenta como voto)
+    const bool per_char = char_confidences.size() == text.size();
+    for (int i = 0; i < POSITIONS; ++i) {
+        const int symbol = symbolIndex(text[i]);
+        if (symbol < 0) {
+            return decision;
+        }
+        const float weight = per_char ? char_confidences[i] : confidence;
+        track->weights[i][symbol] += std::max(0.01f, weight);
+    }
+    track->reads++;
+    stats_.reads++;
+    decision.reads = track->reads;
+
+    if (track->reads < config_.min_reads) {
+        return decision;
+    }
+
+    float min_share = 0.0f;
+    VoteDecision consensus = majority(*track, min_share);
+    const bool agreed = min_share >= config_.consensus || track->reads >= config_.max_reads;
+    if (!agreed || !PlateValidator::isValidColombianFormat(consensus.text)) {
+        return decision;
+    }
+
+    track->resolved = true;
+    track->resolved_at = Clock::now();
+    stats_.emitted++;
+
+    consensus.emit = true;
+    return consensus;
+}
+
+VoteDecision PlateVoter::majority(const Track& track, float& min_share) {
+    // Ganador por posición y su fracción del peso
+    VoteDecision decision;
+    decision.reads = track.reads;
+    min_share = 1.0f;
+    float confidence_sum = 0.0f;
+    for (int i = 0; i < POSITIONS; ++i) {
+        const auto& weights = track.weights[i];
+        const int winner = static_cast<int>(std::max_element(weights.begin(), weights.end()) - weights.begin());
+        float total = 0.0f;
+        for (float w : weights) {
+            total += w;
+        }
+
+        decision.text += symbolChar(winner);
+        min_share = std::min(min_share, total > 0.0f ? weights[winner] / total : 0.0f);
+        confidence_sum += weights[winner] / std::max(1, track.reads);
+    }
+    decision.confidence = std::min(1.0f, confidence_sum / POSITIONS);
+    decision.vehicle_box = track.vehicle_box;
+    decision.plate_type = track.plate_type;
+    return decision;
+}
+
+PlateVoter::Stats PlateVoter::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+PlateVoter::Track* PlateVoter::find(int track_id) {
+    for (Track& track : tracks_) {
+        if (track.id == track_id) {
+            return &track;
+        }
+    }
+    return nullptr;
+}
+
+int PlateVoter::symbolIndex(char c) {
+    if (c >= 'A' && c <= 'Z') {
+        return c - 'A';
+    }
+    if (c >= '0' && c <= '9') {
+        return 26 + (c - '0');
+    }
+    return -1;
+}
+
+char PlateVoter::symbolChar(int index) {
+    return index < 26 ? static_cast<char>('A' + index) : static_cast<char>('0' + index - 26);
+}
+
+} // namespace jetson_lpr
@@ -0,0 +1,58 @@
+#include "startup_timeline.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+namespace jetson_lpr {
+
+StartupTimeline::StartupTimeline()
+    : origin_(Clock::now())
+{
+}
+
+void StartupTimeline::record(const std::string& name, Clock::time_point start, Clock::time_point end) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.push_back({
+        name,
+        std::chrono::duration<double, std::milli>(start - origin_).count(),
+        std::chrono::duration<double, std::milli>(end - start).count()
+    });
+}
+
+double StartupTimeline::mark(const std::string& name) {
+    double now_ms = elapsedMs();
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.push_back({name, now_ms, 0.0});
+    return now_ms;
+}
+
+double StartupTimeline::elapsedMs() const {
+    return std::chrono::duration<double, std::milli>(Clock::now() - origin_).count();
+}
+
+void StartupTimeline::print() const {
+    std::vector<Entry> entries;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries = entries_;
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.start_ms < b.start_ms;
+    });
+
+    std::cout << "⏱️ Línea de tiempo del arranque (ms desde el lanzamiento):" << std::endl;
+    for (const Entry& entry : entries) {
+        std::cout << "   " << std::fixed << std::setprecision(0)
+                  << std::setw(7) << entry.start_ms;
+        if (entry.duration_ms > 0.0) {
+            std::cout << " → " << std::setw(7) << entry.start_ms + entry.duration_ms
+                      << "  (" << std::setw(6) << entry.duration_ms << ")  ";
+        } else {
+            std::cout << std::string(22, ' ') << "● ";
+        }
+        std::cout << entry.name << std::endl;
+    }
+}
+
+} // namespace jetson_lpr
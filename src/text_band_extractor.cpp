@@ -0,0 +1,86 @@
+#include "text_band_extractor.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace jetson_lpr {
+
+TextBandExtractor::TextBandExtractor(const TextBandConfig& config)
+    : config_(config)
+{
+    config_.min_transitions = std::max(1, config_.min_transitions);
+    config_.margin = std::max(0.0f, config_.margin);
+}
+
+cv::Rect TextBandExtractor::locate(const cv::Mat& image) const {
+    const cv::Rect full(0, 0, image.cols, image.rows);
+    if (image.empty() || image.rows < 12 || image.cols < 12) {
+        return full;
+    }
+
+    cv::Mat gray;
+    if (image.channels() == 3) {
+        cv::cvtColor(image, gray, cv::COLOR_BGR2GRAY);
+    } else {
+        gray = image;
+    }
+
+    cv::Mat binary;
+    cv::threshold(gray, binary, 0, 255, cv::THRESH_BINARY | cv::THRESH_OTSU);
+
+    // Proyección horizontal: cambios blanco/negro por fila (no depende de
+    // la polaridad, y el marco es una fila llena sin cambios)
+    std::vector<int> transitions(binary.rows, 0);
+    int peak = 0;
+    for (int y = 0; y < binary.rows; ++y) {
+        const uchar* row = binary.ptr<uchar>(y);
+        int count = 0;
+        for (int x = 1; x < binary.cols; ++x) {
+            count += row[x] != row[x - 1];
+        }
+        transitions[y] = count;
+        peak = std::max(peak, count);
+    }
+
+    const int threshold = std::max(config_.min_transitions,
+                                   static_cast<int>(std::ceil(peak * config_.peak_ratio)));
+    if (peak < threshold) {
+        return full;
+    }
+
+    // Tramo más alto de filas de texto; un hueco de una o dos filas
+    // (trazo horizontal de una E, ruido) no lo corta
+    const int max_gap = std::max(1, binary.rows / 40);
+    int best_top = 0;
+    int best_bottom = -1;
+    int top = -1;
+    int last = -1;
+    for (int y = 0; y <= binary.rows; ++y) {
+        const bool text = y < binary.rows && transitions[y] >= threshold;
+        if (text) {
+            if (top < 0) {
+                top = y;
+            }
+            last = y;
+        }
+        if (top >= 0 && (y == binary.rows || y - last > max_gap)) {
+            if (last - top > best_bottom - best_top) {
+                best_top = top;
+                best_bottom = last;
+            }
+            top = -1;
+        }
+    }
+
+    const int height = best_bottom - best_top + 1;
+    if (height < config_.min_band_ratio * binary.rows) {
+        return full;
+    }
+
+    const int pad = std::max(1, static_cast<int>(std::lround(height * config_.margin)));
+    const int y0 = std::max(0, best_top - pad);
+    const int y1 = std::min(binary.rows, best_bottom + 1 + pad);
+    return cv::Rect(0, y0, binary.cols, y1 - y0);
+}
+
+} // namespace jetson_lpr
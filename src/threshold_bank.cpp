@@ -0,0 +1,228 @@
+#include "threshold_bank.h"
+#include <algorithm>
+#include <cfloat>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LPR_THRESH_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define LPR_THRESH_NEON 1
+#endif
+
+namespace jetson_lpr {
+
+namespace {
+
+// Otsu más los cuatro umbrales fijos
+constexpr int GLOBAL_LEVELS = 5;
+
+} // namespace
+
+ThresholdBank::ThresholdBank()
+    : otsu_level_(0)
+    , adaptive_ready_{false, false}
+{
+}
+
+void ThresholdBank::compute(const cv::Mat& gray) {
+    // Sin lock: compute() no comparte el banco con otros hilos
+    adaptive_ready_[0] = false;
+    adaptive_ready_[1] = false;
+
+    if (gray.empty() || gray.type() != CV_8UC1) {
+        for (cv::Mat& plane : planes_) {
+            plane.release();
+        }
+        gray_.release();
+        otsu_level_ = 0;
+        return;
+    }
+    gray_ = gray;
+
+    // Todos los planos en un solo bloque que solo crece
+    const size_t area = static_cast<size_t>(gray.rows) * gray.cols;
+    if (buffer_.size() < area * STRATEGY_COUNT) {
+        buffer_.resize(area * STRATEGY_COUNT);
+    }
+    for (int i = 0; i < STRATEGY_COUNT; ++i) {
+        planes_[i] = cv::Mat(gray.rows, gray.cols, CV_8UC1, buffer_.data() + i * area);
+    }
+
+    // Histograma: cuatro sub-histogramas para no encadenar incrementos
+    // sobre la misma celda en píxeles consecutivos iguales
+    int histogram[4][256] = {};
+    for (int y = 0; y < gray.rows; ++y) {
+        const uchar* src = gray.ptr<uchar>(y);
+        int x = 0;
+        for (; x + 4 <= gray.cols; x += 4) {
+            histogram[0][src[x]]++;
+            histogram[1][src[x + 1]]++;
+            histogram[2][src[x + 2]]++;
+            histogram[3][src[x + 3]]++;
+        }
+        for (; x < gray.cols; ++x) {
+            histogram[0][src[x]]++;
+        }
+    }
+    for (int i = 0; i < 256; ++i) {
+        histogram[0][i] += histogram[1][i] + histogram[2][i] + histogram[3][i];
+    }
+
+    otsu_level_ = otsuFromHistogram(histogram[0], static_cast<int>(area));
+
+    sweepGlobal(gray);
+}
+
+void ThresholdBank::computeAdaptive(int strategy) const {
+    std::lock_guard<std::mutex> lock(adaptive_mutex_);
+    bool& ready = adaptive_ready_[strategy - ADAPTIVE_MEAN];
+    if (ready || gray_.empty()) {
+        return;
+    }
+
+    // Escribe directo en su plano (mismo tamaño y tipo: sin asignar)
+    cv::Mat plane = planes_[strategy];
+    cv::adaptiveThreshold(gray_, plane, 255,
+                         strategy == ADAPTIVE_MEAN ? cv::ADAPTIVE_THRESH_MEAN_C
+                                                   : cv::ADAPTIVE_THRESH_GAUSSIAN_C,
+                         cv::THRESH_BINARY, 11, 2);
+    ready = true;
+}
+
+int ThresholdBank::otsuFromHistogram(const int* histogram, int total) {
+    // Mismo recorrido que cv::threshold(THRESH_OTSU) para obtener el mismo umbral
+    const double scale = 1.0 / total;
+
+    double mu = 0.0;
+    for (int i = 0; i < 256; ++i) {
+        mu += i * static_cast<double>(histogram[i]);
+    }
+    mu *= scale;
+
+    double mu1 = 0.0;
+    double q1 = 0.0;
+    double max_sigma = 0.0;
+    int level = 0;
+
+    for (int i = 0; i < 256; ++i) {
+        double p_i = histogram[i] * scale;
+        mu1 *= q1;
+        q1 += p_i;
+        double q2 = 1.0 - q1;
+
+        if (std::min(q1, q2) < FLT_EPSILON || std::max(q1, q2) > 1.0 - FLT_EPSILON) {
+            continue;
+        }
+
+        mu1 = (mu1 + i * p_i) / q1;
+        double mu2 = (mu - q1 * mu1) / q2;
+        double sigma = q1 * q2 * (mu1 - mu2) * (mu1 - mu2);
+        if (sigma > max_sigma) {
+            max_sigma = sigma;
+            level = i;
+        }
+    }
+
+    return level;
+}
+
+void ThresholdBank::sweepGlobal(const cv::Mat& gray) {
+    const uchar levels[GLOBAL_LEVELS] = {
+        static_cast<uchar>(otsu_level_), 80, 100, 120, 140
+    };
+
+#if defined(LPR_THRESH_SSE2)
+    // SSE2 solo compara con signo: desplazar ambos lados 0x80
+    const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+    const __m128i ones = _mm_set1_epi8(static_cast<char>(0xFF));
+    __m128i vlevels[GLOBAL_LEVELS];
+    for (int k = 0; k < GLOBAL_LEVELS; ++k) {
+        vlevels[k] = _mm_set1_epi8(static_cast<char>(levels[k] ^ 0x80));
+    }
+#elif defined(LPR_THRESH_NEON)
+    uint8x16_t vlevels[GLOBAL_LEVELS];
+    for (int k = 0; k < GLOBAL_LEVELS; ++k) {
+        vlevels[k] = vdupq_n_u8(levels[k]);
+    }
+#endif
+
+    for (int y = 0; y < gray.rows; ++y) {
+        const uchar* src = gray.ptr<uchar>(y);
+
+        // direct[k]: píxel > umbral -> 255; inverse[k]: el complemento
+        uchar* direct[GLOBAL_LEVELS];
+        uchar* inverse[GLOBAL_LEVELS];
+        direct[0] = planes_[OTSU].ptr<uchar>(y);
+        inverse[0] = planes_[OTSU_INV].ptr<uchar>(y);
+        for (int k = 1; k < GLOBAL_LEVELS; ++k) {
+            direct[k] = planes_[FIRST_FIXED + 2 * (k - 1)].ptr<uchar>(y);
+            inverse[k] = planes_[FIRST_FIXED + 2 * (k - 1) + 1].ptr<uchar>(y);
+        }
+
+        int x = 0;
+
+#if defined(LPR_THRESH_SSE2)
+        for (; x + 16 <= gray.cols; x += 16) {
+            __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x)), bias);
+            for (int k = 0; k < GLOBAL_LEVELS; ++k) {
+                __m128i mask = _mm_cmpgt_epi8(v, vlevels[k]);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(direct[k] + x), mask);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(inverse[k] + x), _mm_xor_si128(mask, ones));
+            }
+        }
+#elif defined(LPR_THRESH_NEON)
+        for (; x + 16 <= gray.cols; x += 16) {
+            uint8x16_t v = vld1q_u8(src + x);
+            for (int k = 0; k < GLOBAL_LEVELS; ++k) {
+                uint8x16_t mask = vcgtq_u8(v, vlevels[k]);
+                vst1q_u8(direct[k] + x, mask);
+                vst1q_u8(inverse[k] + x, vmvnq_u8(mask));
+            }
+        }
+#endif
+
+        // Resto escalar
+        for (; x < gray.cols; ++x) {
+            const uchar v = src[x];
+            for (int k = 0; k < GLOBAL_LEVELS; ++k) {
+                const uchar mask = v > levels[k] ? 255 : 0;
+                direct[k][x] = mask;
+                inverse[k][x] = mask ^ 255;
+            }
+        }
+    }
+}
+
+cv::Mat ThresholdBank::applyStrategy(const cv::Mat& gray, int strategy) {
+    cv::Mat binary;
+
+    switch (strategy) {
+        case OTSU:
+            cv::threshold(gray, binary, 0, 255, cv::THRESH_BINARY + cv::THRESH_OTSU);
+            break;
+        case OTSU_INV:
+            cv::threshold(gray, binary, 0, 255, cv::THRESH_BINARY_INV + cv::THRESH_OTSU);
+            break;
+        case ADAPTIVE_MEAN:
+            cv::adaptiveThreshold(gray, binary, 255,
+                                 cv::ADAPTIVE_THRESH_MEAN_C,
+                                 cv::THRESH_BINARY, 11, 2);
+            break;
+        case ADAPTIVE_GAUSS:
+            cv::adaptiveThreshold(gray, binary, 255,
+                                 cv::ADAPTIVE_THRESH_GAUSSIAN_C,
+                                 cv::THRESH_BINARY, 11, 2);
+            break;
+        default: {
+            // Thresholds manuales 80/100/120/140, directo e inverso
+            int type = ((strategy - FIRST_FIXED) % 2 == 0) ? cv::THRESH_BINARY : cv::THRESH_BINARY_INV;
+            cv::threshold(gray, binary, fixedLevel(strategy), 255, type);
+            break;
+        }
+    }
+
+    return binary;
+}
+
+} // namespace jetson_lpr
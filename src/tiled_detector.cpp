@@ -0,0 +1,236 @@
+#include "tiled_detector.h"
+#include <iostream>
+#include <algorithm>
+#include <future>
+
+namespace jetson_lpr {
+
+TiledDetector::TiledDetector(PlateDetector& detector,
+                             const TilingConfig& config,
+                             DetectionBatcher* batcher)
+    : detector_(detector)
+    , config_(config)
+    , batcher_(batcher)
+    , overlap_px_(0)
+    , frame_count_(0)
+    , tiles_processed_(0)
+    , next_tile_(0)
+{
+    config_.tile_size = std::max(32, config_.tile_size);
+    config_.overlap = std::min(std::max(config_.overlap, 0.0f), 0.5f);
+    config_.interval = std::max(1, config_.interval);
+    config_.batch_size = std::max(1, config_.batch_size);
+
+    NMSConfig nms_config;
+    nms_config.iou_threshold = config_.merge_iou;
+    nms_config.top_k = 0;
+    nms_config.max_detections = 0;
+    nms_.setConfig(nms_config);
+}
+
+bool TiledDetector::shouldRun() {
+    return (frame_count_++ % config_.interval) == 0;
+}
+
+void TiledDetector::buildTiles(const cv::Size& frame_size) {
+    grid_frame_size_ = frame_size;
+    tiles_.clear();
+    next_tile_ = 0;
+
+    cv::Rect frame_rect(0, 0, frame_size.width, frame_size.height);
+    roi_px_ = cv::Rect(
+        static_cast<int>(config_.roi.x * frame_size.width),
+        static_cast<int>(config_.roi.y * frame_size.height),
+        static_cast<int>(config_.roi.width * frame_size.width),
+        static_cast<int>(config_.roi.height * frame_size.height)
+    ) & frame_rect;
+
+    if (roi_px_.empty()) {
+        return;
+    }
+
+    const int tile = config_.tile_size;
+    overlap_px_ = static_cast<int>(tile * config_.overlap);
+    const int stride = std::max(1, tile - overlap_px_);
+
+    // Posiciones a lo largo de un eje: la última tesela se alinea al borde
+    auto positions = [&](int start, int length) {
+        std::vector<int> result;
+        if (length <= tile) {
+            result.push_back(start);
+            return result;
+        }
+        for (int pos = start; ; pos += stride) {
+            if (pos + tile >= start + length) {
+                result.push_back(start + length - tile);
+                break;
+            }
+            result.push_back(pos);
+        }
+        return result;
+    };
+
+    std::vector<cv::Rect> zones_px;
+    for (const cv::Rect2f& zone : config_.zones) {
+        zones_px.emplace_back(
+            static_cast<int>(zone.x * frame_size.width),
+            static_cast<int>(zone.y * frame_size.height),
+            static_cast<int>(zone.width * frame_size.width),
+            static_cast<int>(zone.height * frame_size.height)
+        );
+    }
+
+    for (int y : positions(roi_px_.y, roi_px_.height)) {
+        for (int x : positions(roi_px_.x, roi_px_.width)) {
+            cv::Rect rect = cv::Rect(x, y, tile, tile) & roi_px_;
+
+            bool in_zone = zones_px.empty();
+            for (const cv::Rect& zone : zones_px) {
+                if ((rect & zone).area() > 0) {
+                    in_zone = true;
+                    break;
+                }
+            }
+
+            if (in_zone) {
+                tiles_.push_back(rect);
+            }
+        }
+    }
+
+    std::cout << "🧩 Detección por teselas: " << tiles_.size() << " teselas de "
+              << tile << "px en ROI " << roi_px_.width << "x" << roi_px_.height << std::endl;
+}
+
+const std::vector<cv::Rect>& TiledDetector::getTiles(const cv::Size& frame_size) {
+    if (frame_size != grid_frame_size_) {
+        buildTiles(frame_size);
+    }
+    return tiles_;
+}
+
+bool TiledDetector::isCutByInnerEdge(const cv::Rect& bbox, const cv::Rect& tile) const {
+    const int margin = 2;
+
+    // Solo bordes interiores de la ROI; además la caja debe caber en el
+    // solapamiento para que la tesela vecina la haya visto completa
+    if (bbox.x <= margin && tile.x > roi_px_.x && bbox.width < overlap_px_) {
+        return true;
+    }
+    if (bbox.y <= margin && tile.y > roi_px_.y && bbox.height < overlap_px_) {
+        return true;
+    }
+    if (bbox.br().x >= tile.width - margin && tile.br().x < roi_px_.br().x && bbox.width < overlap_px_) {
+        return true;
+    }
+    if (bbox.br().y >= tile.height - margin && tile.br().y < roi_px_.br().y && bbox.height < overlap_px_) {
+        return true;
+    }
+    return false;
+}
+
+std::vector<PlateDetection> TiledDetector::detect(const cv::Mat& frame) {
+    std::vector<PlateDetection> detections;
+
+    if (frame.empty()) {
+        return detections;
+    }
+
+    const std::vector<cv::Rect>& tiles = getTiles(frame.size());
+    if (tiles.empty()) {
+        return detections;
+    }
+
+    // Teselas de esta ejecución (rotación si hay límite)
+    size_t count = tiles.size();
+    if (config_.max_tiles_per_run > 0) {
+        count = std::min(count, static_cast<size_t>(config_.max_tiles_per_run));
+    }
+
+    std::vector<cv::Rect> selected;
+    selected.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        selected.push_back(tiles[(next_tile_ + i) % tiles.size()]);
+    }
+    next_tile_ = (next_tile_ + count) % tiles.size();
+    tiles_processed_ += count;
+
+    // Vistas sin copia sobre el frame original
+    std::vector<cv::Mat> crops;
+    crops.reserve(selected.size());
+    for (const cv::Rect& rect : selected) {
+        crops.push_back(frame(rect));
+    }
+
+    std::vector<std::vector<PlateDetection>> per_tile;
+    per_tile.reserve(crops.size());
+
+    if (batcher_) {
+        std::vector<std::future<std::vector<PlateDetection>>> futures;
+        for (const cv::Mat& crop : crops) {
+            futures.push_back(batcher_->submit(crop));
+        }
+        for (auto& future : futures) {
+            per_tile.push_back(future.get());
+        }
+    } else {
+        for (size_t start = 0; start < crops.size(); start += config_.batch_size) {
+            size_t end = std::min(crops.size(), start + config_.batch_size);
+            std::vector<cv::Mat> batch(crops.begin() + start, crops.begin() + end);
+            for (auto& result : detector_.detectBatch(batch)) {
+                per_tile.push_back(std::move(result));
+            }
+        }
+    }
+
+    for (size_t t = 0; t < per_tile.size() && t < selected.size(); ++t) {
+        const cv::Rect& tile = selected[t];
+        for (const PlateDetection& det : per_tile[t]) {
+            if (isCutByInnerEdge(det.bbox, tile)) {
+                continue;
+            }
+            PlateDetection global = det;
+            global.bbox.x += tile.x;
+            global.bbox.y += tile.y;
+            detections.push_back(global);
+        }
+    }
+
+    return detections;
+}
+
+std::vector<PlateDetection> TiledDetector::merge(const std::vector<PlateDetection>& full_frame,
+                                                 const std::vector<PlateDetection>& tiled) {
+    candidates_.clear();
+
+    for (const std::vector<PlateDetection>* source : {&full_frame, &tiled}) {
+        for (const PlateDetection& det : *source) {
+            candidates_.push(
+                static_cast<float>(det.bbox.x), static_cast<float>(det.bbox.y),
+                static_cast<float>(det.bbox.x + det.bbox.width),
+                static_cast<float>(det.bbox.y + det.bbox.height),
+                det.confidence, det.class_id
+            );
+        }
+    }
+
+    std::vector<PlateDetection> merged;
+    for (int idx : nms_.run(candidates_)) {
+        merged.emplace_back(
+            cv::Rect(
+                cv::Point(static_cast<int>(candidates_.x1[idx]), static_cast<int>(candidates_.y1[idx])),
+                cv::Point(static_cast<int>(candidates_.x2[idx]), static_cast<int>(candidates_.y2[idx]))
+            ),
+            candidates_.scores[idx],
+            candidates_.class_ids[idx]
+        );
+    }
+
+    return merged;
+}
+
+double TiledDetector::getAverageTilesPerFrame() const {
+    return frame_count_ > 0 ? static_cast<double>(tiles_processed_) / frame_count_ : 0.0;
+}
+
+} // namespace jetson_lpr
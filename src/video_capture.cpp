@@ -92,10 +92,8 @@ bool VideoCapture::start() {
         // Ignorar si no está soportado
     }
     
-    // Esperar un momento para que la conexión se estabilice
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    
     // Verificar que la captura funcione leyendo un frame de prueba
+    // (read() ya espera al primer frame; los reintentos cubren la conexión lenta)
     std::cout << "🔍 Verificando lectura de frames..." << std::endl;
     cv::Mat test_frame;
     int attempts = 0;
@@ -126,6 +124,13 @@ bool VideoCapture::start() {
     std::cout << "   FPS: " << fps << std::endl;
     std::cout << "   URL: " << rtsp_url_ << std::endl;
     
+    // El frame de prueba es el primero del pipeline: no esperar al siguiente
+    {
+        std::lock_guard<std::mutex> queue_lock(queue_mutex_);
+        frame_queue_.push(test_frame);
+    }
+    frame_count_++;
+    
     // Iniciar hilo de captura
     running_ = true;
     started_ = true;
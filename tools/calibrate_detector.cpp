@@ -0,0 +1,199 @@
+/**
+ * Generador de datos de calibración para cuantización INT8 del detector
+ *
+ * Pasa cada frame por PlateDetector::preprocess (mismo tamaño, escala y
+ * orden de canales que en producción) y guarda el tensor
+ * resultante como .npy junto con un manifiesto. scripts/quantize_model.py
+ * consume ese manifiesto para calibrar el modelo en formato QDQ.
+ *
+ * Uso: calibrate_detector <frames> <directorio_salida> [opciones]
+ */
+
+#include "detector.h"
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+#include <cstdio>
+#include <cstdint>
+#include <opencv2/opencv.hpp>
+
+using namespace jetson_lpr;
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * Guardar un blob float32 en formato NumPy (.npy v1.0)
+ */
+bool writeNpy(const std::string& path, const cv::Mat& blob) {
+    std::string shape;
+    for (int i = 0; i < blob.dims; ++i) {
+        shape += std::to_string(blob.size[i]) + ", ";
+    }
+    if (blob.dims > 1) {
+        shape.erase(shape.size() - 2);
+    }
+
+    std::string header = "{'descr': '<f4', 'fortran_order': False, 'shape': (" + shape + "), }";
+
+    // Magic (6) + versión (2) + longitud (2) + header + '\n' múltiplo de 64
+    size_t total = 10 + header.size() + 1;
+    header.append((64 - total % 64) % 64, ' ');
+    header.push_back('\n');
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    const char magic[] = {'\x93', 'N', 'U', 'M', 'P', 'Y', 1, 0};
+    file.write(magic, sizeof(magic));
+
+    uint16_t header_len = static_cast<uint16_t>(header.size());
+    file.put(static_cast<char>(header_len & 0xFF));
+    file.put(static_cast<char>(header_len >> 8));
+    file.write(header.data(), header.size());
+
+    file.write(reinterpret_cast<const char*>(blob.data), blob.total() * blob.elemSize());
+    return file.good();
+}
+
+/**
+ * Listar imágenes de un directorio en orden estable
+ */
+std::vector<std::string> listImages(const std::string& directory) {
+    static const std::vector<std::string> extensions = {".jpg", ".jpeg", ".png", ".bmp"};
+
+    std::vector<std::string> images;
+    for (const auto& entry : fs::directory_iterator(directory)) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+        std::string ext = entry.path().extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+        if (std::find(extensions.begin(), extensions.end(), ext) != extensions.end()) {
+            images.push_back(entry.path().string());
+        }
+    }
+
+    std::sort(images.begin(), images.end());
+    return images;
+}
+
+void printUsage(const char* program_name) {
+    std::cout << "Uso: " << program_name << " <frames> <directorio_salida> [opciones]\n"
+              << "\n"
+              << "  <frames>              Directorio de imágenes o archivo de video\n"
+              << "\n"
+              << "OPCIONES:\n"
+              << "  --max N               Máximo de muestras (default: 300)\n"
+              << "  --stride N            En video, tomar 1 de cada N frames (default: 15)\n"
+              << "  --input-size N        Entrada del modelo NxN (default: 640)\n"
+              << "\n"
+              << "Después: python3 scripts/quantize_model.py <modelo.onnx> <directorio_salida>/calibration.txt\n"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string input = argv[1];
+    std::string output_dir = argv[2];
+    int max_samples = 300;
+    int stride = 15;
+    int input_size = 640;
+
+    for (int i = 3; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--max" && i + 1 < argc) {
+            max_samples = std::stoi(argv[++i]);
+        } else if (arg == "--stride" && i + 1 < argc) {
+            stride = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--input-size" && i + 1 < argc) {
+            input_size = std::max(1, std::stoi(argv[++i]));
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::error_code ec;
+    fs::create_directories(output_dir, ec);
+    if (ec) {
+        std::cerr << "Error: No se pudo crear " << output_dir << ": " << ec.message() << std::endl;
+        return 1;
+    }
+
+    // preprocess() no requiere el modelo cargado; el tamaño debe ser el
+    // del modelo exportado
+    PlateDetector detector("");
+    detector.setPrimaryInputSize(cv::Size(input_size, input_size));
+    cv::Mat blob;
+
+    std::ofstream manifest(output_dir + "/calibration.txt");
+    if (!manifest.is_open()) {
+        std::cerr << "Error: No se pudo escribir el manifiesto en " << output_dir << std::endl;
+        return 1;
+    }
+
+    int written = 0;
+    auto addSample = [&](const cv::Mat& frame) {
+        detector.preprocess(frame, blob);
+
+        char name[32];
+        std::snprintf(name, sizeof(name), "sample_%05d.npy", written);
+        std::string path = output_dir + "/" + name;
+
+        if (!writeNpy(path, blob)) {
+            std::cerr << "⚠️ No se pudo escribir " << path << std::endl;
+            return;
+        }
+        manifest << name << "\n";
+        ++written;
+    };
+
+    if (fs::is_directory(input)) {
+        std::vector<std::string> images = listImages(input);
+        // Muestreo uniforme si hay más imágenes que muestras
+        size_t step = std::max<size_t>(1, images.size() / std::max(1, max_samples));
+        for (size_t i = 0; i < images.size() && written < max_samples; i += step) {
+            cv::Mat frame = cv::imread(images[i]);
+            if (frame.empty()) {
+                std::cerr << "⚠️ Imagen ilegible: " << images[i] << std::endl;
+                continue;
+            }
+            addSample(frame);
+        }
+    } else {
+        cv::VideoCapture capture(input);
+        if (!capture.isOpened()) {
+            std::cerr << "Error: No se pudo abrir " << input << std::endl;
+            return 1;
+        }
+
+        cv::Mat frame;
+        for (int index = 0; written < max_samples && capture.read(frame); ++index) {
+            if (index % stride == 0) {
+                addSample(frame);
+            }
+        }
+    }
+
+    if (written == 0) {
+        std::cerr << "Error: No se generaron muestras de calibración" << std::endl;
+        return 1;
+    }
+
+    std::cout << "✅ " << written << " muestras de calibración en " << output_dir << std::endl;
+    return 0;
+}
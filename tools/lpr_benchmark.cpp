@@ -0,0 +1,1025 @@
+/**
+ * Benchmarks de componentes del sistema LPR
+ *
+ * Uso: lpr_benchmark <comando> [opciones]
+ */
+
+#include "nms.h"
+#include "detector.h"
+#include "ocr_processor.h"
+#include "ctc_plate_recognizer.h"
+#include "fixed_font_recognizer.h"
+#include "plate_rectifier.h"
+#include "plate_validator.h"
+#include "threshold_bank.h"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <filesystem>
+#include <opencv2/opencv.hpp>
+
+using namespace jetson_lpr;
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * Medir tiempo promedio de una función (microsegundos por llamada)
+ */
+double measureMicros(const std::function<void()>& fn, int iterations) {
+    // Calentamiento
+    for (int i = 0; i < std::max(1, iterations / 10); ++i) {
+        fn();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        fn();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+/**
+ * Generar candidatos sintéticos tipo YOLO: grupos de cajas alrededor de
+ * algunas placas más ruido disperso
+ */
+void generateCandidates(int count, CandidateBuffer& candidates, std::mt19937& rng) {
+    std::uniform_real_distribution<float> pos(0.0f, 1800.0f);
+    std::uniform_real_distribution<float> size(40.0f, 160.0f);
+    std::uniform_real_distribution<float> jitter(-8.0f, 8.0f);
+    std::uniform_real_distribution<float> score(0.30f, 1.0f);
+
+    candidates.clear();
+
+    const int clusters = std::max(1, count / 50);
+    std::vector<cv::Rect2f> centers;
+    for (int c = 0; c < clusters; ++c) {
+        float w = size(rng);
+        centers.emplace_back(pos(rng), pos(rng) * 0.6f, w, w * 0.5f);
+    }
+
+    for (int i = 0; i < count; ++i) {
+        const cv::Rect2f& base = centers[i % clusters];
+        float x = base.x + jitter(rng);
+        float y = base.y + jitter(rng);
+        float w = base.width + jitter(rng);
+        float h = base.height + jitter(rng);
+        candidates.push(x, y, x + w, y + h, score(rng), 0);
+    }
+}
+
+int benchNMS(int argc, char* argv[]) {
+    int iterations = 200;
+    float iou_threshold = 0.5f;
+
+    for (int i = 0; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::stoi(argv[++i]);
+        } else if (arg == "--iou" && i + 1 < argc) {
+            iou_threshold = std::stof(argv[++i]);
+        }
+    }
+
+    std::cout << "📊 NMS: FastNMS vs cv::dnn::NMSBoxes (" << iterations << " iteraciones)" << std::endl;
+    std::cout << std::setw(12) << "candidatos"
+              << std::setw(16) << "NMSBoxes (us)"
+              << std::setw(16) << "FastNMS (us)"
+              << std::setw(16) << "top-K (us)"
+              << std::setw(16) << "soft-NMS (us)"
+              << std::setw(10) << "kept" << std::endl;
+
+    std::mt19937 rng(42);
+
+    for (int count : {100, 1000, 8400}) {
+        CandidateBuffer candidates;
+        candidates.reserve(count);
+        generateCandidates(count, candidates, rng);
+
+        // Referencia: lo que hacía applyNMS (copia a vectores + NMSBoxes)
+        std::vector<int> indices;
+        double opencv_us = measureMicros([&]() {
+            std::vector<cv::Rect> bboxes;
+            std::vector<float> confidences;
+            for (size_t i = 0; i < candidates.size(); ++i) {
+                bboxes.emplace_back(
+                    static_cast<int>(candidates.x1[i]),
+                    static_cast<int>(candidates.y1[i]),
+                    static_cast<int>(candidates.x2[i] - candidates.x1[i]),
+                    static_cast<int>(candidates.y2[i] - candidates.y1[i])
+                );
+                confidences.push_back(candidates.scores[i]);
+            }
+            cv::dnn::NMSBoxes(bboxes, confidences, 0.3f, iou_threshold, indices);
+        }, iterations);
+
+        NMSConfig config;
+        config.iou_threshold = iou_threshold;
+        config.top_k = 0;
+        config.max_detections = 0;
+
+        FastNMS nms(config);
+        nms.reserve(count);
+        size_t kept = 0;
+        double fast_us = measureMicros([&]() {
+            kept = nms.run(candidates).size();
+        }, iterations);
+
+        config.top_k = 300;
+        nms.setConfig(config);
+        double topk_us = measureMicros([&]() {
+            nms.run(candidates);
+        }, iterations);
+
+        // Soft-NMS modifica scores: trabajar sobre una copia por iteración
+        config.soft_nms = true;
+        nms.setConfig(config);
+        CandidateBuffer soft_candidates;
+        soft_candidates.reserve(count);
+        double soft_us = measureMicros([&]() {
+            soft_candidates.clear();
+            for (size_t i = 0; i < candidates.size(); ++i) {
+                soft_candidates.push(candidates.x1[i], candidates.y1[i],
+                                     candidates.x2[i], candidates.y2[i],
+                                     candidates.scores[i], candidates.class_ids[i]);
+            }
+            nms.run(soft_candidates);
+        }, iterations);
+
+        std::cout << std::setw(12) << count
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(16) << opencv_us
+                  << std::setw(16) << fast_us
+                  << std::setw(16) << topk_us
+                  << std::setw(16) << soft_us
+                  << std::setw(10) << kept
+                  << " (NMSBoxes: " << indices.size() << ")" << std::endl;
+    }
+
+    return 0;
+}
+
+/**
+ * Frame de evaluación con su ground truth (si hay etiquetas)
+ */
+struct EvalFrame {
+    std::string path;
+    cv::Mat image;
+    std::vector<cv::Rect> ground_truth;
+    std::vector<std::string> ground_truth_text;  // Texto de cada caja (vacío si no se etiquetó)
+};
+
+/**
+ * Cargar frames de un directorio y sus etiquetas YOLO (<nombre>.txt con
+ * "clase cx cy w h [PLACA]" normalizados) si se indica directorio de etiquetas
+ */
+std::vector<EvalFrame> loadEvalFrames(const std::string& frames_dir, const std::string& labels_dir,
+                                      int max_frames) {
+    std::vector<std::string> paths;
+    for (const auto& entry : fs::directory_iterator(frames_dir)) {
+        std::string ext = entry.path().extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+        if (entry.is_regular_file() && (ext == ".jpg" || ext == ".jpeg" || ext == ".png" || ext == ".bmp")) {
+            paths.push_back(entry.path().string());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+    if (max_frames > 0 && static_cast<int>(paths.size()) > max_frames) {
+        paths.resize(max_frames);
+    }
+
+    std::vector<EvalFrame> frames;
+    for (const std::string& path : paths) {
+        EvalFrame frame;
+        frame.path = path;
+        frame.image = cv::imread(path);
+        if (frame.image.empty()) {
+            continue;
+        }
+
+        if (!labels_dir.empty()) {
+            std::ifstream labels(labels_dir + "/" + fs::path(path).stem().string() + ".txt");
+            std::string line;
+            while (std::getline(labels, line)) {
+                std::istringstream fields(line);
+                int class_id;
+                float cx, cy, w, h;
+                if (fields >> class_id >> cx >> cy >> w >> h) {
+                    float fw = static_cast<float>(frame.image.cols);
+                    float fh = static_cast<float>(frame.image.rows);
+                    frame.ground_truth.emplace_back(
+                        static_cast<int>((cx - w / 2) * fw), static_cast<int>((cy - h / 2) * fh),
+                        static_cast<int>(w * fw), static_cast<int>(h * fh)
+                    );
+                    std::string text;
+                    fields >> text;
+                    frame.ground_truth_text.push_back(PlateValidator::normalizeColombianPlate(text));
+                }
+            }
+        }
+
+        frames.push_back(std::move(frame));
+    }
+
+    return frames;
+}
+
+/**
+ * Average Precision a IoU 0.5 (interpolación de todos los puntos, una clase)
+ */
+double computeAP50(const std::vector<std::vector<PlateDetection>>& detections,
+                   const std::vector<std::vector<cv::Rect>>& ground_truth) {
+    struct Scored { float confidence; size_t frame; cv::Rect box; };
+
+    std::vector<Scored> all;
+    size_t total_gt = 0;
+    for (size_t f = 0; f < detections.size(); ++f) {
+        for (const PlateDetection& det : detections[f]) {
+            all.push_back({det.confidence, f, det.bbox});
+        }
+        total_gt += ground_truth[f].size();
+    }
+    if (total_gt == 0) {
+        return 0.0;
+    }
+
+    std::sort(all.begin(), all.end(), [](const Scored& a, const Scored& b) {
+        return a.confidence > b.confidence;
+    });
+
+    std::vector<std::vector<bool>> matched(ground_truth.size());
+    for (size_t f = 0; f < ground_truth.size(); ++f) {
+        matched[f].assign(ground_truth[f].size(), false);
+    }
+
+    std::vector<double> precision, recall;
+    size_t tp = 0;
+    for (size_t i = 0; i < all.size(); ++i) {
+        const Scored& det = all[i];
+        double best_iou = 0.0;
+        int best = -1;
+        for (size_t g = 0; g < ground_truth[det.frame].size(); ++g) {
+            const cv::Rect& gt = ground_truth[det.frame][g];
+            double inter = (det.box & gt).area();
+            double iou = inter / (det.box.area() + gt.area() - inter + 1e-9);
+            if (iou > best_iou) {
+                best_iou = iou;
+                best = static_cast<int>(g);
+            }
+        }
+        if (best >= 0 && best_iou >= 0.5 && !matched[det.frame][best]) {
+            matched[det.frame][best] = true;
+            ++tp;
+        }
+        precision.push_back(static_cast<double>(tp) / (i + 1));
+        recall.push_back(static_cast<double>(tp) / total_gt);
+    }
+
+    // Envolvente de precisión y área bajo la curva
+    double ap = 0.0;
+    double prev_recall = 0.0;
+    for (size_t i = 0; i < precision.size(); ++i) {
+        double max_precision = *std::max_element(precision.begin() + i, precision.end());
+        ap += (recall[i] - prev_recall) * max_precision;
+        prev_recall = recall[i];
+    }
+    return ap;
+}
+
+int benchDetector(int argc, char* argv[]) {
+    std::string fp32_model;
+    std::string int8_model;
+    std::string frames_dir;
+    std::string labels_dir;
+    std::string backend = "opencv";
+    bool with_fp16 = true;
+    int max_frames = 200;
+    int iterations = 3;
+    float confidence = 0.25f;
+
+    for (int i = 0; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--fp32" && i + 1 < argc) {
+            fp32_model = argv[++i];
+        } else if (arg == "--int8" && i + 1 < argc) {
+            int8_model = argv[++i];
+        } else if (arg == "--frames" && i + 1 < argc) {
+            frames_dir = argv[++i];
+        } else if (arg == "--labels" && i + 1 < argc) {
+            labels_dir = argv[++i];
+        } else if (arg == "--backend" && i + 1 < argc) {
+            backend = argv[++i];
+        } else if (arg == "--max-frames" && i + 1 < argc) {
+            max_frames = std::stoi(argv[++i]);
+        } else if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--conf" && i + 1 < argc) {
+            confidence = std::stof(argv[++i]);
+        } else if (arg == "--no-fp16") {
+            with_fp16 = false;
+        }
+    }
+
+    if (fp32_model.empty() || frames_dir.empty()) {
+        std::cerr << "Error: detector requiere --fp32 <modelo> y --frames <directorio>" << std::endl;
+        return 1;
+    }
+
+    std::vector<EvalFrame> frames = loadEvalFrames(frames_dir, labels_dir, max_frames);
+    if (frames.empty()) {
+        std::cerr << "Error: No hay imágenes en " << frames_dir << std::endl;
+        return 1;
+    }
+
+    // ONNX Runtime no convierte a FP16 en carga: la fila sería FP32 otra vez
+    if (with_fp16 && backend == "onnxruntime") {
+        std::cout << "⚠️  Backend onnxruntime sin conversión a FP16: se omite la fila FP16" << std::endl;
+        with_fp16 = false;
+    }
+
+    struct Variant { std::string label; std::string model; std::string precision; };
+    std::vector<Variant> variants = {{"FP32", fp32_model, "fp32"}};
+    if (with_fp16) {
+        variants.push_back({"FP16", fp32_model, "fp16"});
+    }
+    if (!int8_model.empty()) {
+        variants.push_back({"INT8", int8_model, "int8"});
+    }
+
+    std::vector<std::vector<cv::Rect>> ground_truth;
+    for (const EvalFrame& frame : frames) {
+        ground_truth.push_back(frame.ground_truth);
+    }
+    bool pseudo_ground_truth = labels_dir.empty();
+
+    std::cout << "📊 Detector: " << frames.size() << " frames, backend " << backend
+              << ", " << iterations << " pasadas"
+              << (pseudo_ground_truth ? " (mAP contra detecciones FP32)" : "") << std::endl;
+    std::cout << std::setw(8) << "modelo"
+              << std::setw(14) << "media (ms)"
+              << std::setw(12) << "p50 (ms)"
+              << std::setw(12) << "p95 (ms)"
+              << std::setw(12) << "mAP@0.5"
+              << std::setw(14) << "Δ latencia"
+              << std::setw(12) << "Δ mAP" << std::endl;
+
+    double base_mean = 0.0;
+    double base_map = 0.0;
+
+    for (const Variant& variant : variants) {
+        InferenceOptions options;
+        options.backend = backend;
+        options.precision = variant.precision;
+
+        PlateDetector detector(variant.model, confidence, options);
+        if (!detector.initialize()) {
+            std::cerr << "⚠️ " << variant.label << ": no se pudo cargar " << variant.model << std::endl;
+            continue;
+        }
+
+        // Calentamiento (asignación de buffers, autotuning del runtime)
+        for (size_t i = 0; i < std::min<size_t>(3, frames.size()); ++i) {
+            detector.detect(frames[i].image);
+        }
+
+        std::vector<double> latencies;
+        std::vector<std::vector<PlateDetection>> detections(frames.size());
+        for (int pass = 0; pass < iterations; ++pass) {
+            for (size_t f = 0; f < frames.size(); ++f) {
+                auto start = std::chrono::steady_clock::now();
+                std::vector<PlateDetection> result = detector.detect(frames[f].image);
+                auto end = std::chrono::steady_clock::now();
+                latencies.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+                if (pass == 0) {
+                    detections[f] = std::move(result);
+                }
+            }
+        }
+
+        if (pseudo_ground_truth && variant.precision == "fp32") {
+            for (size_t f = 0; f < frames.size(); ++f) {
+                ground_truth[f].clear();
+                for (const PlateDetection& det : detections[f]) {
+                    ground_truth[f].push_back(det.bbox);
+                }
+            }
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        double mean = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+        double p50 = latencies[latencies.size() / 2];
+        double p95 = latencies[std::min(latencies.size() - 1, latencies.size() * 95 / 100)];
+        double map50 = computeAP50(detections, ground_truth);
+
+        if (variant.precision == "fp32") {
+            base_mean = mean;
+            base_map = map50;
+        }
+
+        std::cout << std::setw(8) << variant.label
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(14) << mean
+                  << std::setw(12) << p50
+                  << std::setw(12) << p95
+                  << std::setprecision(4)
+                  << std::setw(12) << map50
+                  << std::setprecision(1)
+                  << std::setw(13) << (base_mean > 0 ? (mean / base_mean - 1.0) * 100.0 : 0.0) << "%"
+                  << std::setprecision(4)
+                  << std::setw(12) << (map50 - base_map) << std::endl;
+    }
+
+    return 0;
+}
+
+int benchOCR(int argc, char* argv[]) {
+    std::string model;
+    std::string frames_dir;
+    std::string labels_dir;
+    std::string backend = "opencv";
+    int max_frames = 200;
+    int resolution = 800;
+    float confidence = 0.25f;
+    bool parallel = false;
+    int engines = 0;
+    int preselect = 0;
+    std::string crnn_model;
+    int crnn_beam = 1;
+    bool fixed_font = false;
+    std::string glyphs_path = "models/plate_glyphs.yml";
+    std::string save_glyphs;
+    bool rectify = false;
+    bool text_band = false;
+
+    for (int i = 0; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--parallel") {
+            parallel = true;
+        } else if (arg == "--preselect" && i + 1 < argc) {
+            preselect = std::max(0, std::stoi(argv[++i]));
+        } else if (arg == "--crnn" && i + 1 < argc) {
+            crnn_model = argv[++i];
+        } else if (arg == "--crnn-beam" && i + 1 < argc) {
+            crnn_beam = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--text-band") {
+            text_band = true;
+        } else if (arg == "--rectify") {
+            rectify = true;
+        } else if (arg == "--fixed-font") {
+            fixed_font = true;
+        } else if (arg == "--glyphs" && i + 1 < argc) {
+            glyphs_path = argv[++i];
+        } else if (arg == "--save-glyphs" && i + 1 < argc) {
+            save_glyphs = argv[++i];
+        } else if (arg == "--engines" && i + 1 < argc) {
+            engines = std::max(0, std::stoi(argv[++i]));
+        } else if (arg == "--model" && i + 1 < argc) {
+            model = argv[++i];
+        } else if (arg == "--frames" && i + 1 < argc) {
+            frames_dir = argv[++i];
+        } else if (arg == "--labels" && i + 1 < argc) {
+            labels_dir = argv[++i];
+        } else if (arg == "--backend" && i + 1 < argc) {
+            backend = argv[++i];
+        } else if (arg == "--max-frames" && i + 1 < argc) {
+            max_frames = std::stoi(argv[++i]);
+        } else if (arg == "--resolution" && i + 1 < argc) {
+            resolution = std::stoi(argv[++i]);
+        } else if (arg == "--conf" && i + 1 < argc) {
+            confidence = std::stof(argv[++i]);
+        }
+    }
+
+    if (model.empty() || frames_dir.empty()) {
+        std::cerr << "Error: ocr requiere --model <modelo> y --frames <directorio>" << std::endl;
+        return 1;
+    }
+
+    std::vector<EvalFrame> frames = loadEvalFrames(frames_dir, labels_dir, max_frames);
+    if (frames.empty()) {
+        std::cerr << "Error: No hay imágenes en " << frames_dir << std::endl;
+        return 1;
+    }
+
+    InferenceOptions options;
+    options.backend = backend;
+    PlateDetector detector(model, confidence, options);
+    if (!detector.initialize()) {
+        std::cerr << "Error: no se pudo cargar " << model << std::endl;
+        return 1;
+    }
+
+    OCRProcessor ocr("eng", "", static_cast<size_t>(engines));
+    if (!ocr.initialize()) {
+        std::cerr << "Error: no se pudo inicializar el OCR" << std::endl;
+        return 1;
+    }
+
+    // Por defecto intentos en orden: resultados reproducibles entre corridas
+    ocr.setDeterministic(!parallel);
+
+    // Reconocedor CTC sobre los mismos recortes originales, un lote por frame
+    std::unique_ptr<OCRProcessor> crnn_ocr;
+    if (!crnn_model.empty()) {
+        CTCRecognizerConfig crnn_config;
+        crnn_config.model_path = crnn_model;
+        crnn_config.beam_width = crnn_beam;
+        crnn_config.inference.backend = backend;
+        crnn_ocr = std::make_unique<OCRProcessor>();
+        crnn_ocr->setRecognizer(std::make_unique<CTCPlateRecognizer>(crnn_config));
+        if (!crnn_ocr->initialize() || crnn_ocr->getEngineName() == "tesseract") {
+            std::cerr << "Error: no se pudo cargar " << crnn_model << std::endl;
+            return 1;
+        }
+    }
+
+    // Segmentación + kNN sobre los recortes originales (ruta rápida del OCR)
+    FixedFontConfig font_config;
+    font_config.templates_path = glyphs_path;
+    FixedFontRecognizer fixed(font_config);
+    if (fixed_font && !fixed.initialize()) {
+        std::cerr << "Error: no se pudo inicializar el reconocedor de fuente fija" << std::endl;
+        return 1;
+    }
+
+    // Plantillas nuevas con los glifos de las placas etiquetadas
+    FixedFontRecognizer glyph_builder(font_config);
+    int glyph_plates = 0;
+
+    // Mismo camino que LPRSystem: detectar en el frame reducido y recortar
+    // la placa del frame reducido (antes) o del original (ahora)
+    struct Totals {
+        int crops = 0;
+        int attempts = 0;
+        int valid = 0;
+        int labeled = 0;
+        int correct = 0;
+        double ocr_ms = 0.0;
+    };
+    Totals reduced_totals;
+    Totals full_totals;
+    Totals preselect_totals;
+    Totals crnn_totals;
+    Totals fixed_totals;
+    Totals rectified_totals;
+    Totals band_totals;
+
+    // Cache de OCR con cada tolerancia, guardando la etiqueta: un acierto
+    // con otro texto es una placa devuelta por la de otro vehículo
+    std::vector<std::unique_ptr<OCRResultCache>> cache_probes;
+    for (int distance = 0; distance <= 3; ++distance) {
+        OCRCacheConfig probe_config;
+        probe_config.max_distance = distance;
+        probe_config.ttl_seconds = 0.0;
+        cache_probes.push_back(std::make_unique<OCRResultCache>(probe_config));
+    }
+    std::vector<int> cache_hits(cache_probes.size(), 0);
+    std::vector<int> cache_false_hits(cache_probes.size(), 0);
+    int cache_labeled = 0;
+    PlateRectifier rectifier;
+    int fixed_accepted = 0;
+    int fixed_accepted_labeled = 0;
+    int fixed_accepted_correct = 0;
+
+    auto score = [](const OCRResult& result, const std::string& expected, Totals& totals) {
+        std::string text = PlateValidator::normalizeColombianPlate(result.text);
+        totals.crops++;
+        totals.attempts += result.attempts;
+        if (PlateValidator::isValidColombianFormat(text)) {
+            totals.valid++;
+        }
+        if (!expected.empty()) {
+            totals.labeled++;
+            if (text == expected) {
+                totals.correct++;
+            }
+        }
+    };
+
+    auto evaluate = [&ocr, &score, &rectifier](const cv::Mat& image, const cv::Rect& box, const std::string& expected,
+                                               Totals& totals, bool rectified = false) {
+        cv::Rect roi = box & cv::Rect(0, 0, image.cols, image.rows);
+        if (roi.empty()) {
+            return;
+        }
+
+        // El tiempo incluye la rectificación
+        auto start = std::chrono::steady_clock::now();
+        cv::Mat crop = rectified ? rectifier.rectify(image, roi) : image(roi);
+        // Sin cache: el recorte reducido y el original de la misma placa se parecen
+        OCRResult result = ocr.recognizeMultipleAttempts(crop, false);
+        auto end = std::chrono::steady_clock::now();
+
+        score(result, expected, totals);
+        totals.ocr_ms += std::chrono::duration<double, std::milli>(end - start).count();
+    };
+
+    for (const EvalFrame& frame : frames) {
+        cv::Mat processing_frame = frame.image;
+        if (frame.image.cols > resolution * 1.2) {
+            double scale = static_cast<double>(resolution) / frame.image.cols;
+            cv::resize(frame.image, processing_frame, cv::Size(), scale, scale, cv::INTER_LINEAR);
+        }
+
+        std::vector<PlateDetection> detections = detector.detect(processing_frame);
+        std::vector<PlateDetection> mapped = mapDetectionsToFrame(detections, processing_frame.size(), frame.image.size());
+        std::vector<cv::Mat> crnn_crops;
+        std::vector<std::string> crnn_expected;
+
+        for (size_t d = 0; d < detections.size(); ++d) {
+            // Texto esperado: etiqueta con mayor IoU (>= 0.5)
+            std::string expected;
+            double best_iou = 0.5;
+            for (size_t g = 0; g < frame.ground_truth.size() && g < frame.ground_truth_text.size(); ++g) {
+                const cv::Rect& gt = frame.ground_truth[g];
+                double inter = (mapped[d].bbox & gt).area();
+                double iou = inter / (mapped[d].bbox.area() + gt.area() - inter + 1e-9);
+                if (iou >= best_iou) {
+                    best_iou = iou;
+                    expected = frame.ground_truth_text[g];
+                }
+            }
+
+            evaluate(processing_frame, detections[d].bbox, expected, reduced_totals);
+            evaluate(frame.image, mapped[d].bbox, expected, full_totals);
+            if (rectify) {
+                evaluate(frame.image, mapped[d].bbox, expected, rectified_totals, true);
+            }
+
+            // Mismo recorte, pero Tesseract solo sobre las binarizaciones mejor puntuadas
+            if (preselect > 0) {
+                ocr.setPreselection(preselect);
+                evaluate(frame.image, mapped[d].bbox, expected, preselect_totals);
+                ocr.setPreselection(0);
+            }
+
+            // Mismo recorte, pero Tesseract solo sobre la banda de los caracteres
+            if (text_band) {
+                ocr.setTextBand(true);
+                evaluate(frame.image, mapped[d].bbox, expected, band_totals);
+                ocr.setTextBand(false);
+            }
+
+            cv::Rect roi = mapped[d].bbox & cv::Rect(0, 0, frame.image.cols, frame.image.rows);
+
+            if (!expected.empty() && !roi.empty()) {
+                const uint64_t hash = OCRResultCache::perceptualHash(frame.image(roi));
+                for (size_t p = 0; p < cache_probes.size(); ++p) {
+                    OCRResult cached;
+                    if (cache_probes[p]->lookup(hash, cached)) {
+                        cache_hits[p]++;
+                        if (cached.text != expected) {
+                            cache_false_hits[p]++;
+                        }
+                    }
+                    cache_probes[p]->insert(hash, OCRResult(expected, 1.0f));
+                }
+                cache_labeled++;
+            }
+
+            if (fixed_font && !roi.empty()) {
+                auto start = std::chrono::steady_clock::now();
+                OCRResult result = fixed.recognize(frame.image(roi));
+                auto end = std::chrono::steady_clock::now();
+
+                score(result, expected, fixed_totals);
+                fixed_totals.ocr_ms += std::chrono::duration<double, std::milli>(end - start).count();
+
+                // Lo que OCRProcessor aceptaría sin llamar al OCR
+                if (result.confidence >= 0.8f && PlateValidator::isValidColombianFormat(result.text)) {
+                    fixed_accepted++;
+                    if (!expected.empty()) {
+                        fixed_accepted_labeled++;
+                        if (result.text == expected) {
+                            fixed_accepted_correct++;
+                        }
+                    }
+                }
+            }
+
+            // Un glifo por carácter si la segmentación coincide con la etiqueta
+            if (!save_glyphs.empty() && !roi.empty() && PlateValidator::isValidColombianFormat(expected)) {
+                cv::Mat foreground;
+                std::vector<cv::Rect> boxes;
+                if (glyph_builder.segment(frame.image(roi), foreground, boxes) && boxes.size() == expected.size()) {
+                    for (size_t c = 0; c < boxes.size(); ++c) {
+                        glyph_builder.addSample(FixedFontRecognizer::glyphFeatures(foreground, boxes[c]), expected[c]);
+                    }
+                    glyph_plates++;
+                }
+            }
+
+            if (crnn_ocr && !roi.empty()) {
+                crnn_crops.push_back(frame.image(roi));
+                crnn_expected.push_back(expected);
+            }
+        }
+
+        // Todas las placas del frame en una inferencia, como en LPRSystem
+        if (crnn_ocr && !crnn_crops.empty()) {
+            auto start = std::chrono::steady_clock::now();
+            std::vector<OCRResult> results = crnn_ocr->recognizeBatch(crnn_crops, false);
+            auto end = std::chrono::steady_clock::now();
+
+            for (size_t c = 0; c < results.size(); ++c) {
+                score(results[c], crnn_expected[c], crnn_totals);
+            }
+            crnn_totals.ocr_ms += std::chrono::duration<double, std::milli>(end - start).count();
+        }
+    }
+
+    std::cout << "📊 OCR: " << frames.size() << " frames, detección a " << resolution << " px, "
+              << (parallel ? "intentos en paralelo (" + std::to_string(ocr.getEngineCount()) + " instancias)"
+                           : "intentos en orden (determinista)") << std::endl;
+    std::cout << std::setw(12) << "recorte"
+              << std::setw(10) << "placas"
+              << std::setw(12) << "intentos"
+              << std::setw(14) << "OCR (ms)"
+              << std::setw(14) << "formato ok"
+              << std::setw(12) << "exactitud" << std::endl;
+
+    std::vector<std::pair<std::string, const Totals*>> rows = {
+        {"reducido", &reduced_totals}, {"original", &full_totals}
+    };
+    if (preselect > 0) {
+        rows.emplace_back("top-" + std::to_string(preselect) + " CC", &preselect_totals);
+    }
+    if (text_band) {
+        rows.emplace_back("banda texto", &band_totals);
+    }
+    if (rectify) {
+        rows.emplace_back("rectificado", &rectified_totals);
+    }
+    if (fixed_font) {
+        rows.emplace_back("fuente fija", &fixed_totals);
+    }
+    if (crnn_ocr) {
+        rows.emplace_back(crnn_beam > 1 ? "CRNN beam " + std::to_string(crnn_beam) : std::string("CRNN"),
+                          &crnn_totals);
+    }
+
+    for (const auto& row : rows) {
+        const Totals& totals = *row.second;
+        double crops = std::max(1, totals.crops);
+        std::cout << std::setw(12) << row.first
+                  << std::setw(10) << totals.crops
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(12) << totals.attempts / crops
+                  << std::setw(14) << totals.ocr_ms / crops
+                  << std::setprecision(1)
+                  << std::setw(13) << 100.0 * totals.valid / crops << "%";
+        if (totals.labeled > 0) {
+            std::cout << std::setw(11) << 100.0 * totals.correct / totals.labeled << "%";
+        } else {
+            std::cout << std::setw(12) << "-";
+        }
+        std::cout << std::endl;
+    }
+
+    if (preselect > 0 && full_totals.attempts > 0) {
+        std::cout << "   Preselección: " << std::setprecision(1)
+                  << 100.0 * (full_totals.attempts - preselect_totals.attempts) / full_totals.attempts
+                  << "% menos llamadas a Tesseract";
+        if (full_totals.labeled > 0) {
+            double delta = 100.0 * (preselect_totals.correct - full_totals.correct) / full_totals.labeled;
+            std::cout << ", exactitud " << std::showpos << delta << std::noshowpos << " puntos";
+        }
+        std::cout << std::endl;
+    }
+
+    if (text_band && full_totals.attempts > 0) {
+        std::cout << "   Banda de texto: " << std::setprecision(1)
+                  << 100.0 * (full_totals.attempts - band_totals.attempts) / full_totals.attempts
+                  << "% menos llamadas a Tesseract";
+        if (full_totals.labeled > 0) {
+            double delta = 100.0 * (band_totals.correct - full_totals.correct) / full_totals.labeled;
+            std::cout << ", exactitud " << std::showpos << delta << std::noshowpos << " puntos";
+        }
+        std::cout << std::endl;
+    }
+
+    if (rectify && full_totals.attempts > 0) {
+        PlateRectifier::Stats rectifier_stats = rectifier.getStats();
+        std::cout << "   Rectificación: " << std::setprecision(1)
+                  << 100.0 * (full_totals.attempts - rectified_totals.attempts) / full_totals.attempts
+                  << "% menos llamadas a Tesseract (" << rectifier_stats.estimated << " estimadas, "
+                  << rectifier_stats.cached << " con geometría del carril, "
+                  << rectifier_stats.passthrough << " sin rectificar)";
+        if (full_totals.labeled > 0) {
+            double delta = 100.0 * (rectified_totals.correct - full_totals.correct) / full_totals.labeled;
+            std::cout << ", exactitud " << std::showpos << delta << std::noshowpos << " puntos";
+        }
+        std::cout << std::endl;
+    }
+
+    if (cache_labeled > 0) {
+        std::cout << "   Cache de OCR (" << cache_labeled << " placas etiquetadas, en orden):" << std::endl;
+        for (size_t p = 0; p < cache_probes.size(); ++p) {
+            std::cout << "      distancia " << p << ": " << std::setprecision(1)
+                      << 100.0 * cache_hits[p] / cache_labeled << "% aciertos, "
+                      << 100.0 * cache_false_hits[p] / std::max(1, cache_hits[p])
+                      << "% de ellos con otra placa" << std::endl;
+        }
+    }
+
+    if (fixed_font && fixed_totals.crops > 0) {
+        std::cout << "   Ruta rápida: " << std::setprecision(1)
+                  << 100.0 * fixed_accepted / fixed_totals.crops << "% de las placas sin OCR";
+        if (fixed_accepted_labeled > 0) {
+            std::cout << ", exactitud de las aceptadas "
+                      << 100.0 * fixed_accepted_correct / fixed_accepted_labeled << "%";
+        }
+        std::cout << std::endl;
+    }
+
+    if (!save_glyphs.empty()) {
+        if (glyph_builder.letterCount() == 0 || glyph_builder.digitCount() == 0 ||
+            !glyph_builder.saveTemplates(save_glyphs)) {
+            std::cerr << "Error: no se guardaron plantillas en " << save_glyphs << std::endl;
+            return 1;
+        }
+        std::cout << "   Plantillas: " << glyph_builder.letterCount() << " letras y "
+                  << glyph_builder.digitCount() << " dígitos de " << glyph_plates
+                  << " placas en " << save_glyphs << std::endl;
+    }
+
+    if (crnn_ocr && crnn_totals.crops > 0 && full_totals.crops > 0) {
+        std::cout << "   CRNN vs. Tesseract (original): " << std::setprecision(1)
+                  << (full_totals.ocr_ms / full_totals.crops) / std::max(1e-6, crnn_totals.ocr_ms / crnn_totals.crops)
+                  << "x más rápido";
+        if (full_totals.labeled > 0) {
+            double delta = 100.0 * (crnn_totals.correct - full_totals.correct) / full_totals.labeled;
+            std::cout << ", exactitud " << std::showpos << delta << std::noshowpos << " puntos";
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
+
+/**
+ * Placa sintética en gris: fondo con gradiente de iluminación y ruido,
+ * seis caracteres oscuros y marco
+ */
+cv::Mat makeSyntheticPlate(int width, int height, std::mt19937& rng) {
+    cv::Mat plate(height, width, CV_8UC1);
+    std::uniform_int_distribution<int> background(140, 200);
+    int base = background(rng);
+    for (int y = 0; y < height; ++y) {
+        uchar* row = plate.ptr<uchar>(y);
+        for (int x = 0; x < width; ++x) {
+            row[x] = cv::saturate_cast<uchar>(base - 40 * x / width);
+        }
+    }
+
+    int char_width = width / 9;
+    for (int c = 0; c < 6; ++c) {
+        int x = width / 12 + c * (char_width + char_width / 3);
+        cv::rectangle(plate, cv::Rect(x, height / 5, char_width, height * 3 / 5),
+                      cv::Scalar(30 + 10 * c), cv::FILLED);
+    }
+    cv::rectangle(plate, cv::Rect(0, 0, width, height), cv::Scalar(20), 2);
+
+    cv::Mat noise(height, width, CV_16SC1);
+    cv::randn(noise, 0, 12);
+    cv::add(plate, noise, plate, cv::noArray(), CV_8U);
+    return plate;
+}
+
+int benchThresholds(int argc, char* argv[]) {
+    int iterations = 2000;
+
+    for (int i = 0; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::max(1, std::stoi(argv[++i]));
+        }
+    }
+
+    std::cout << "📊 Binarizaciones del OCR: 12 pasadas de OpenCV vs. banco fusionado ("
+              << iterations << " iteraciones)" << std::endl;
+    std::cout << std::setw(10) << "recorte"
+              << std::setw(16) << "OpenCV (us)"
+              << std::setw(16) << "fusionado (us)"
+              << std::setw(10) << "speedup"
+              << std::setw(8) << "otsu"
+              << std::setw(14) << "px distintos" << std::endl;
+
+    std::mt19937 rng(42);
+    ThresholdBank bank;
+
+    // Recortes típicos de placa (≈ 2:1) desde lejos hasta muy cerca
+    const std::vector<cv::Size> sizes = {
+        {80, 40}, {120, 60}, {180, 90}, {260, 130}, {400, 200}
+    };
+
+    for (const cv::Size& size : sizes) {
+        cv::Mat gray = makeSyntheticPlate(size.width, size.height, rng);
+
+        // Referencia: una llamada y una asignación por variante
+        std::vector<cv::Mat> reference;
+        double opencv_us = measureMicros([&]() {
+            reference.clear();
+            for (int s = 0; s < ThresholdBank::STRATEGY_COUNT; ++s) {
+                reference.push_back(ThresholdBank::applyStrategy(gray, s));
+            }
+        }, iterations);
+
+        // Con los adaptativos, que el banco calcula al pedirlos
+        double fused_us = measureMicros([&]() {
+            bank.compute(gray);
+            bank.plane(ThresholdBank::ADAPTIVE_MEAN);
+            bank.plane(ThresholdBank::ADAPTIVE_GAUSS);
+        }, iterations);
+
+        // Ambos caminos deben dar exactamente las mismas imágenes
+        int mismatched = 0;
+        for (int s = 0; s < ThresholdBank::STRATEGY_COUNT; ++s) {
+            cv::Mat diff;
+            cv::compare(reference[s], bank.plane(s), diff, cv::CMP_NE);
+            mismatched += cv::countNonZero(diff);
+        }
+
+        std::ostringstream label;
+        label << size.width << "x" << size.height;
+
+        std::cout << std::setw(10) << label.str()
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(16) << opencv_us
+                  << std::setw(16) << fused_us
+                  << std::setw(9) << opencv_us / std::max(fused_us, 1e-3) << "x"
+                  << std::setw(8) << bank.otsuLevel()
+                  << std::setw(14) << mismatched << std::endl;
+    }
+
+    return 0;
+}
+
+void printUsage(const char* program_name) {
+    std::cout << "Uso: " << program_name << " <comando> [opciones]\n"
+              << "\n"
+              << "COMANDOS:\n"
+              << "  nms [--iterations N] [--iou T]    NMS con 100/1000/8400 candidatos\n"
+              << "  detector --fp32 M --frames DIR      Latencia y mAP@0.5 FP32/FP16/INT8\n"
+              << "           [--int8 M] [--labels DIR] [--backend B] [--no-fp16]\n"
+              << "           [--max-frames N] [--iterations N] [--conf T]\n"
+              << "  ocr --model M --frames DIR          Intentos y exactitud del OCR con recortes\n"
+              << "      [--labels DIR] [--resolution N] del frame reducido vs. original\n"
+              << "      [--backend B] [--max-frames N] [--conf T]\n"
+              << "      [--parallel] [--engines N]       (por defecto determinista)\n"
+              << "      [--preselect N]                 + solo las N mejores por componentes\n"
+              << "      [--crnn M] [--crnn-beam N]      + reconocedor CTC en lote por frame\n"
+              << "      [--text-band]                   + solo la banda de los caracteres\n"
+              << "      [--rectify]                     + placa rectificada (perspectiva)\n"
+              << "      [--fixed-font] [--glyphs F]     + segmentación y kNN (ruta rápida)\n"
+              << "      [--save-glyphs F]               guardar plantillas de las placas etiquetadas\n"
+              << "  thresholds [--iterations N]       Binarizaciones del OCR: OpenCV vs. fusionado\n"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string command = argv[1];
+
+    if (command == "nms") {
+        return benchNMS(argc - 2, argv + 2);
+    }
+
+    if (command == "detector") {
+        return benchDetector(argc - 2, argv + 2);
+    }
+
+    if (command == "ocr") {
+        return benchOCR(argc - 2, argv + 2);
+    }
+
+    if (command == "thresholds") {
+        return benchThresholds(argc - 2, argv + 2);
+    }
+
+    if (command == "-h" || command == "--help") {
+        printUsage(argv[0]);
+        return 0;
+    }
+
+    std::cerr << "Comando desconocido: " << command << std::endl;
+    printUsage(argv[0]);
+    return 1;
+}